@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/atcf/AtcfCache.cpp" "src/CMakeFiles/gahm_objectlib.dir/atcf/AtcfCache.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/atcf/AtcfCache.cpp.o.d"
+  "/root/repo/src/atcf/AtcfFile.cpp" "src/CMakeFiles/gahm_objectlib.dir/atcf/AtcfFile.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/atcf/AtcfFile.cpp.o.d"
+  "/root/repo/src/atcf/AtcfSnap.cpp" "src/CMakeFiles/gahm_objectlib.dir/atcf/AtcfSnap.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/atcf/AtcfSnap.cpp.o.d"
+  "/root/repo/src/atcf/CompiledTrack.cpp" "src/CMakeFiles/gahm_objectlib.dir/atcf/CompiledTrack.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/atcf/CompiledTrack.cpp.o.d"
+  "/root/repo/src/atcf/TimeIndex.cpp" "src/CMakeFiles/gahm_objectlib.dir/atcf/TimeIndex.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/atcf/TimeIndex.cpp.o.d"
+  "/root/repo/src/datatypes/Date.cpp" "src/CMakeFiles/gahm_objectlib.dir/datatypes/Date.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/datatypes/Date.cpp.o.d"
+  "/root/repo/src/datatypes/PointIndex.cpp" "src/CMakeFiles/gahm_objectlib.dir/datatypes/PointIndex.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/datatypes/PointIndex.cpp.o.d"
+  "/root/repo/src/gahm/GahmBatchSolver.cpp" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmBatchSolver.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmBatchSolver.cpp.o.d"
+  "/root/repo/src/gahm/GahmEquations.cpp" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmEquations.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmEquations.cpp.o.d"
+  "/root/repo/src/gahm/GahmRadiusSolver.cpp" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmRadiusSolver.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmRadiusSolver.cpp.o.d"
+  "/root/repo/src/gahm/GahmRadiusSolverPrivate.cpp" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmRadiusSolverPrivate.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmRadiusSolverPrivate.cpp.o.d"
+  "/root/repo/src/gahm/GahmSolver.cpp" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmSolver.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/gahm/GahmSolver.cpp.o.d"
+  "/root/repo/src/output/OwiOutput.cpp" "src/CMakeFiles/gahm_objectlib.dir/output/OwiOutput.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/output/OwiOutput.cpp.o.d"
+  "/root/repo/src/preprocessor/Preprocessor.cpp" "src/CMakeFiles/gahm_objectlib.dir/preprocessor/Preprocessor.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/preprocessor/Preprocessor.cpp.o.d"
+  "/root/repo/src/preprocessor/SolutionCache.cpp" "src/CMakeFiles/gahm_objectlib.dir/preprocessor/SolutionCache.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/preprocessor/SolutionCache.cpp.o.d"
+  "/root/repo/src/util/BinaryFile.cpp" "src/CMakeFiles/gahm_objectlib.dir/util/BinaryFile.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/util/BinaryFile.cpp.o.d"
+  "/root/repo/src/util/MappedFile.cpp" "src/CMakeFiles/gahm_objectlib.dir/util/MappedFile.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/util/MappedFile.cpp.o.d"
+  "/root/repo/src/vortex/PolarGrid.cpp" "src/CMakeFiles/gahm_objectlib.dir/vortex/PolarGrid.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/vortex/PolarGrid.cpp.o.d"
+  "/root/repo/src/vortex/Vortex.cpp" "src/CMakeFiles/gahm_objectlib.dir/vortex/Vortex.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/vortex/Vortex.cpp.o.d"
+  "/root/repo/src/vortex/VortexKernelPrivate.cpp" "src/CMakeFiles/gahm_objectlib.dir/vortex/VortexKernelPrivate.cpp.o" "gcc" "src/CMakeFiles/gahm_objectlib.dir/vortex/VortexKernelPrivate.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
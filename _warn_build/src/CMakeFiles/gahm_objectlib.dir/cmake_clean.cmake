@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gahm_objectlib.dir/atcf/AtcfCache.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/atcf/AtcfCache.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/atcf/AtcfFile.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/atcf/AtcfFile.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/atcf/AtcfSnap.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/atcf/AtcfSnap.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/atcf/CompiledTrack.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/atcf/CompiledTrack.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/atcf/TimeIndex.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/atcf/TimeIndex.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/datatypes/Date.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/datatypes/Date.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/datatypes/PointIndex.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/datatypes/PointIndex.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmBatchSolver.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmBatchSolver.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmEquations.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmEquations.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmRadiusSolver.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmRadiusSolver.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmRadiusSolverPrivate.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmRadiusSolverPrivate.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmSolver.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/gahm/GahmSolver.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/output/OwiOutput.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/output/OwiOutput.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/preprocessor/Preprocessor.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/preprocessor/Preprocessor.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/preprocessor/SolutionCache.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/preprocessor/SolutionCache.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/util/BinaryFile.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/util/BinaryFile.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/util/MappedFile.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/util/MappedFile.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/vortex/PolarGrid.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/vortex/PolarGrid.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/vortex/Vortex.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/vortex/Vortex.cpp.o.d"
+  "CMakeFiles/gahm_objectlib.dir/vortex/VortexKernelPrivate.cpp.o"
+  "CMakeFiles/gahm_objectlib.dir/vortex/VortexKernelPrivate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gahm_objectlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libgahm.pdb"
+  "libgahm.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gahm_shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -111,6 +111,9 @@ def main():
     parser.add_argument("--interactive", action="store_true", help="Interactive mode")
     parser.add_argument("--output", type=str, help="Base name for output images")
     parser.add_argument("--time", type=datetime.fromisoformat, help="Time to plot")
+    parser.add_argument(
+        "--cache", type=str, help="File used to cache the preprocessor solutions"
+    )
     parser.add_argument("file", type=str, help="ATCF file to plot")
     args = parser.parse_args()
 
@@ -125,6 +128,9 @@ def main():
     # ...Run the preprocessor
     prep = pygahm.Preprocessor(atcf)
     prep.prepareAtcfData()
+    if args.cache:
+        cache = pygahm.SolutionCache(args.cache)
+        prep.setSolutionCache(cache)
     prep.solve()
 
     # ...Generate the vortex
@@ -0,0 +1,288 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "AtcfCache.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "atcf/AtcfFile.h"
+#include "atcf/AtcfIsotach.h"
+#include "atcf/AtcfQuadrant.h"
+#include "atcf/AtcfSnap.h"
+#include "atcf/StormPosition.h"
+#include "atcf/StormTranslation.h"
+#include "datatypes/Date.h"
+#include "util/BinaryFile.h"
+#include "util/MappedFile.h"
+
+namespace Gahm::Atcf {
+
+namespace {
+
+using Gahm::detail::BinaryFile::append;
+using Gahm::detail::BinaryFile::extract;
+using Gahm::detail::BinaryFile::fnv1a;
+
+constexpr std::array<char, 8> c_magic = {'G', 'A', 'H', 'M', 'T', 'R', 'K', 0};
+
+//...Written as a native integer so that a cache from a machine with the other
+// byte order is rejected
+constexpr uint32_t c_byte_order = 0x01020304;
+
+struct t_header {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t source_size;
+  uint64_t source_hash;
+  uint64_t snap_count;
+  uint64_t isotach_count;
+  uint64_t name_bytes;
+  uint64_t checksum;
+};
+
+struct t_snap_record {
+  double central_pressure;
+  double background_pressure;
+  double radius_to_max_winds;
+  double vmax;
+  double vmax_boundary_layer;
+  double holland_b;
+  double x;
+  double y;
+  double translation_speed;
+  double translation_direction;
+  int64_t date_milliseconds;
+  int32_t storm_id;
+  int32_t basin;
+  uint64_t isotach_count;
+  uint64_t name_offset;
+  uint64_t name_length;
+};
+
+struct t_quadrant_record {
+  double isotach_radius;
+  double radius_to_max_wind_speed;
+  double gahm_holland_b;
+  double isotach_speed_at_boundary_layer;
+  double vmax_at_boundary_layer;
+  int64_t quadrant_index;
+};
+
+struct t_isotach_record {
+  double wind_speed;
+  std::array<t_quadrant_record, 4> quadrants;
+};
+
+//...Every record is a whole number of 8 byte words, so the records in a
+// mapped file are aligned and there is no padding to leave uninitialized
+static_assert(sizeof(t_header) == 64);
+static_assert(sizeof(t_snap_record) == 15 * sizeof(uint64_t));
+static_assert(sizeof(t_isotach_record) == 25 * sizeof(uint64_t));
+static_assert(std::is_trivially_copyable_v<t_header> &&
+              std::is_trivially_copyable_v<t_snap_record> &&
+              std::is_trivially_copyable_v<t_isotach_record>);
+
+}  // namespace
+
+/**
+ * Writes the cache for a preprocessed ATCF file. The file is written under a
+ * temporary name and renamed over the cache, so a reader never sees a
+ * partially written cache
+ * @param atcf ATCF file after the preprocessor has been run
+ * @param cache_filename Name of the cache file
+ */
+void AtcfCache::write(const AtcfFile &atcf, const std::string &cache_filename) {
+  const Gahm::detail::MappedFile source(atcf.filename());
+
+  std::string names;
+  size_t isotach_count = 0;
+  for (const auto &snap : atcf.data()) {
+    isotach_count += snap.isotachCount();
+    names += snap.stormName();
+  }
+
+  std::string records;
+  records.reserve(atcf.size() * sizeof(t_snap_record) +
+                  isotach_count * sizeof(t_isotach_record) + names.size());
+
+  size_t name_offset = 0;
+  for (const auto &snap : atcf.data()) {
+    t_snap_record record{};
+    record.central_pressure = snap.centralPressure();
+    record.background_pressure = snap.backgroundPressure();
+    record.radius_to_max_winds = snap.radiusToMaxWinds();
+    record.vmax = snap.vmax();
+    record.vmax_boundary_layer = snap.vmaxBoundaryLayer();
+    record.holland_b = snap.hollandB();
+    record.x = snap.position().x();
+    record.y = snap.position().y();
+    record.translation_speed = snap.translation().translationSpeed();
+    record.translation_direction = snap.translation().translationDirection();
+    record.date_milliseconds = snap.date().toMSeconds();
+    record.storm_id = snap.stormId();
+    record.basin = static_cast<int32_t>(snap.basin());
+    record.isotach_count = snap.isotachCount();
+    record.name_offset = name_offset;
+    record.name_length = snap.stormName().size();
+    name_offset += snap.stormName().size();
+    append(records, record);
+  }
+
+  for (const auto &snap : atcf.data()) {
+    for (const auto &isotach : snap.isotachs()) {
+      t_isotach_record record{};
+      record.wind_speed = isotach.windSpeed();
+      for (int i = 0; i < 4; ++i) {
+        const auto &quadrant = isotach.quadrant(i);
+        record.quadrants[static_cast<size_t>(i)] = {
+            quadrant.isotachRadius(),
+            quadrant.radiusToMaxWindSpeed(),
+            quadrant.gahmHollandB(),
+            quadrant.isotachSpeedAtBoundaryLayer(),
+            quadrant.vmaxAtBoundaryLayer(),
+            quadrant.quadrantIndex()};
+      }
+      append(records, record);
+    }
+  }
+  records += names;
+
+  t_header header{};
+  header.magic = c_magic;
+  header.version = c_version;
+  header.byte_order = c_byte_order;
+  header.source_size = source.size();
+  header.source_hash = fnv1a(source.view());
+  header.snap_count = atcf.size();
+  header.isotach_count = isotach_count;
+  header.name_bytes = names.size();
+  header.checksum = fnv1a(records);
+
+  std::string contents;
+  contents.reserve(sizeof(header) + records.size());
+  append(contents, header);
+  contents += records;
+  Gahm::detail::BinaryFile::replace(cache_filename, contents);
+}
+
+/**
+ * Reads the cache for an ATCF file
+ * @param cache_filename Name of the cache file
+ * @param source_filename Name of the ATCF file the cache should match
+ * @return The preprocessed ATCF file, or no value if the cache does not exist,
+ * is damaged, was written by another version, or was built from a different
+ * ATCF file
+ */
+auto AtcfCache::read(const std::string &cache_filename,
+                     const std::string &source_filename)
+    -> std::optional<AtcfFile> {
+  std::error_code ec;
+  if (!std::filesystem::is_regular_file(cache_filename, ec) ||
+      !std::filesystem::is_regular_file(source_filename, ec)) {
+    return {};
+  }
+
+  const Gahm::detail::MappedFile cache(cache_filename);
+  auto contents = cache.view();
+  if (contents.size() < sizeof(t_header)) return {};
+
+  const auto header = extract<t_header>(contents);
+  if (header.magic != c_magic || header.version != c_version ||
+      header.byte_order != c_byte_order) {
+    return {};
+  }
+
+  //...Compare the sizes before the record counts are trusted
+  if (header.snap_count > contents.size() / sizeof(t_snap_record) ||
+      header.isotach_count > contents.size() / sizeof(t_isotach_record) ||
+      contents.size() != header.snap_count * sizeof(t_snap_record) +
+                             header.isotach_count * sizeof(t_isotach_record) +
+                             header.name_bytes) {
+    return {};
+  }
+  if (fnv1a(contents) != header.checksum) return {};
+
+  {
+    const Gahm::detail::MappedFile source(source_filename);
+    if (source.size() != header.source_size ||
+        fnv1a(source.view()) != header.source_hash) {
+      return {};
+    }
+  }
+
+  auto isotachs = contents.substr(header.snap_count * sizeof(t_snap_record));
+  const auto names = contents.substr(contents.size() - header.name_bytes);
+
+  AtcfFile atcf(source_filename, true);
+  uint64_t isotachs_read = 0;
+  for (uint64_t i = 0; i < header.snap_count; ++i) {
+    const auto record = extract<t_snap_record>(contents);
+    if (record.name_offset + record.name_length > names.size() ||
+        isotachs_read + record.isotach_count > header.isotach_count) {
+      return {};
+    }
+
+    Gahm::Datatypes::Date date;
+    date.fromMSeconds(record.date_milliseconds);
+
+    AtcfSnap snap(static_cast<AtcfSnap::BASIN>(record.basin),
+                  record.central_pressure, record.background_pressure,
+                  record.radius_to_max_winds, record.vmax, date,
+                  record.storm_id,
+                  std::string(names.substr(record.name_offset,
+                                           record.name_length)));
+    snap.setVmaxBoundaryLayer(record.vmax_boundary_layer);
+    snap.setHollandB(record.holland_b);
+    snap.setPosition({record.x, record.y});
+    snap.setTranslation(
+        {record.translation_speed, record.translation_direction});
+
+    for (uint64_t j = 0; j < record.isotach_count; ++j) {
+      const auto iso = extract<t_isotach_record>(isotachs);
+      AtcfIsotach isotach(iso.wind_speed, {0.0, 0.0, 0.0, 0.0});
+      for (int k = 0; k < 4; ++k) {
+        const auto &q = iso.quadrants[static_cast<size_t>(k)];
+        isotach.quadrant(k) = AtcfQuadrant(
+            static_cast<int>(q.quadrant_index), q.isotach_radius,
+            q.radius_to_max_wind_speed, q.gahm_holland_b,
+            q.isotach_speed_at_boundary_layer, q.vmax_at_boundary_layer);
+      }
+      snap.addIsotach(isotach);
+    }
+    isotachs_read += record.isotach_count;
+
+    snap.processIsotachRadii();
+    atcf.addAtcfSnap(snap);
+  }
+
+  return atcf;
+}
+
+}  // namespace Gahm::Atcf
@@ -0,0 +1,61 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_ATCF_ATCFCACHE_H_
+#define GAHM_SRC_ATCF_ATCFCACHE_H_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "atcf/AtcfFile.h"
+
+namespace Gahm::Atcf {
+
+/**
+ * @brief Binary cache of a preprocessed ATCF file
+ *
+ * The cache holds every value of the snaps, isotachs and quadrants after
+ * Preprocessor::prepareAtcfData() and Preprocessor::solve() have run, so a
+ * process which finds a valid cache can build a Vortex without parsing the
+ * ATCF text or running the radius solver. The file is a fixed size header
+ * followed by arrays of fixed size records and is read with a single memory
+ * mapping.
+ *
+ * The header records a format version, a checksum of the records, and the
+ * size and a hash of the ATCF file the cache was built from. A cache that
+ * fails any of these checks is ignored rather than reported as an error, so
+ * the caller can rebuild it.
+ */
+class AtcfCache {
+ public:
+  static constexpr uint32_t c_version = 1;
+
+  static void write(const Gahm::Atcf::AtcfFile &atcf,
+                    const std::string &cache_filename);
+
+  static auto read(const std::string &cache_filename,
+                   const std::string &source_filename)
+      -> std::optional<Gahm::Atcf::AtcfFile>;
+};
+
+}  // namespace Gahm::Atcf
+
+#endif  // GAHM_SRC_ATCF_ATCFCACHE_H_
@@ -20,16 +20,18 @@
 //
 #include "AtcfFile.h"
 
-#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include "AtcfSnap.h"
+#include "util/MappedFile.h"
 
 namespace Gahm::Atcf {
 
@@ -41,16 +43,21 @@ AtcfFile::AtcfFile(std::string filename, bool quiet)
     : m_filename(std::move(filename)), m_quiet(quiet) {}
 
 /*
- * Reads the ATCF file
+ * Reads the ATCF file. The file is mapped into memory and each line is parsed
+ * in place
  */
 void AtcfFile::read() {
-  auto file_obj = std::make_unique<std::ifstream>(m_filename);
-  if (!file_obj->is_open()) {
-    throw std::runtime_error("Unable to open file: " + m_filename);
-  }
+  const Gahm::detail::MappedFile file(m_filename);
+
+  auto contents = file.view();
+  while (!contents.empty()) {
+    const auto end_of_line = contents.find('\n');
+    auto line = contents.substr(0, end_of_line);
+    contents.remove_prefix(end_of_line == std::string_view::npos
+                               ? contents.size()
+                               : end_of_line + 1);
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
 
-  std::string line;
-  while (std::getline(*(file_obj.get()), line)) {
     if (!line.empty()) {
       auto snap = AtcfSnap::parseAtcfSnap(line);
       if (snap.has_value()) {
@@ -59,8 +66,7 @@ void AtcfFile::read() {
         }
       } else {
         if (!m_quiet) {
-          std::cerr << "[WARNING]: Invalid ATCF snap: "
-                    << snap->date().toString() << '\n';
+          std::cerr << "[WARNING]: Invalid ATCF line: " << line << '\n';
         }
       }
     }
@@ -68,20 +74,72 @@ void AtcfFile::read() {
 }
 
 /*
- * Adds a snap to the ATCF file
+ * Adds a snap to the ATCF file. If a snap with the same date already exists,
+ * the isotachs are added to that snap instead
  * @param snap Snap to add
  */
 void AtcfFile::addAtcfSnap(const AtcfSnap& snap) {
-  const auto iter =
-      std::find_if(m_atcfSnaps.begin(), m_atcfSnaps.end(),
-                   [&](const auto& val) { return val.date() == snap.date(); });
-  if (iter == m_atcfSnaps.end()) {
+  const auto index = this->snapIndex(snap.date());
+  if (index == m_atcfSnaps.size()) {
+    m_date_index.emplace(snap.date().toMSeconds(), m_atcfSnaps.size());
     m_atcfSnaps.push_back(snap);
+    m_indexed_snaps = m_atcfSnaps.size();
   } else {
     for (const auto& iso : snap.isotachs()) {
-      iter->addIsotach(iso);
+      m_atcfSnaps[index].addIsotach(iso);
     }
   }
+  this->markModified();
+}
+
+/*
+ * Returns the revision of the snaps. The revision changes each time a snap is
+ * added, a non-const accessor is used or the snaps are marked as modified, so
+ * an object built from the track, such as a Vortex, can tell when it needs to
+ * be rebuilt
+ * @return Revision of the snaps
+ */
+auto AtcfFile::revision() const -> uint64_t { return m_revision; }
+
+/*
+ * Records that the snaps have changed. This is called by the non-const
+ * accessors and the Preprocessor. It only needs to be called directly when a
+ * reference returned by an accessor is kept and used to change the snaps
+ * after an object built from the track, such as a Vortex, has been used
+ */
+void AtcfFile::markModified() { m_revision++; }
+
+/*
+ * Finds the snap with the given date
+ * @param date Date of the snap
+ * @return Iterator to the snap, or end() if there is no snap at the date
+ */
+auto AtcfFile::find(const Gahm::Datatypes::Date& date)
+    -> std::vector<AtcfSnap>::iterator {
+  this->markModified();
+  return m_atcfSnaps.begin() +
+         static_cast<std::ptrdiff_t>(this->snapIndex(date));
+}
+
+/*
+ * Returns the position of the snap with the given date using the date index.
+ * Snaps which were added or removed without going through addAtcfSnap are
+ * brought into the index first
+ * @param date Date of the snap
+ * @return Position of the snap, or the number of snaps if there is no snap at
+ * the date
+ */
+auto AtcfFile::snapIndex(const Gahm::Datatypes::Date& date) -> size_t {
+  if (m_indexed_snaps > m_atcfSnaps.size()) {
+    m_date_index.clear();
+    m_indexed_snaps = 0;
+  }
+  for (; m_indexed_snaps < m_atcfSnaps.size(); ++m_indexed_snaps) {
+    m_date_index.emplace(m_atcfSnaps[m_indexed_snaps].date().toMSeconds(),
+                         m_indexed_snaps);
+  }
+  const auto it = m_date_index.find(date.toMSeconds());
+  return it == m_date_index.end() ? m_atcfSnaps.size() : it->second;
 }
 
 /*
@@ -21,9 +21,10 @@
 #ifndef GAHM_SRC_ATCF_ATCFFILE_H_
 #define GAHM_SRC_ATCF_ATCFFILE_H_
 
-#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "atcf/AtcfSnap.h"
@@ -47,7 +48,13 @@ class AtcfFile {
 
   NODISCARD auto size() const -> size_t;
 
-  std::vector<Gahm::Atcf::AtcfSnap>& data() { return m_atcfSnaps; }
+  //...The non-const accessors return references which can change the snaps,
+  // so each of them marks the snaps as modified. A reference which is kept
+  // and used to change the snaps later needs another call to markModified()
+  std::vector<Gahm::Atcf::AtcfSnap>& data() {
+    this->markModified();
+    return m_atcfSnaps;
+  }
 
 #ifndef SWIG
   NODISCARD auto data() const -> const std::vector<Gahm::Atcf::AtcfSnap>& {
@@ -58,6 +65,7 @@ class AtcfFile {
   NODISCARD auto empty() const -> bool { return m_atcfSnaps.empty(); }
 
   NODISCARD Atcf::AtcfSnap& at(size_t index) {
+    this->markModified();
     return m_atcfSnaps.at(index);
   }
 #ifndef SWIG
@@ -65,33 +73,44 @@ class AtcfFile {
     return m_atcfSnaps.at(index);
   }
 
-  NODISCARD auto front() -> Atcf::AtcfSnap& { return m_atcfSnaps.front(); }
+  NODISCARD auto front() -> Atcf::AtcfSnap& {
+    this->markModified();
+    return m_atcfSnaps.front();
+  }
   NODISCARD auto front() const -> const Atcf::AtcfSnap& {
     return m_atcfSnaps.front();
   }
 
-  NODISCARD auto back() -> Atcf::AtcfSnap& { return m_atcfSnaps.back(); }
+  NODISCARD auto back() -> Atcf::AtcfSnap& {
+    this->markModified();
+    return m_atcfSnaps.back();
+  }
   NODISCARD auto back() const -> const Atcf::AtcfSnap& {
     return m_atcfSnaps.back();
   }
 
   //...Iterators
-  NODISCARD auto begin() { return m_atcfSnaps.begin(); }
+  NODISCARD auto begin() {
+    this->markModified();
+    return m_atcfSnaps.begin();
+  }
   NODISCARD auto begin() const { return m_atcfSnaps.begin(); }
   NODISCARD auto cbegin() const { return m_atcfSnaps.cbegin(); }
 
-  NODISCARD auto end() { return m_atcfSnaps.end(); }
+  NODISCARD auto end() {
+    this->markModified();
+    return m_atcfSnaps.end();
+  }
   NODISCARD auto end() const { return m_atcfSnaps.end(); }
   NODISCARD auto cend() const { return m_atcfSnaps.cend(); }
 
   //...Find
-  auto find(const Gahm::Datatypes::Date& date) {
-    return std::find_if(m_atcfSnaps.begin(), m_atcfSnaps.end(),
-                        [&](const auto& val) { return val.date() == date; });
-  }
+  auto find(const Gahm::Datatypes::Date& date)
+      -> std::vector<Gahm::Atcf::AtcfSnap>::iterator;
 
   //...Indexing
   auto operator[](size_t index) -> Gahm::Atcf::AtcfSnap& {
+    this->markModified();
     return m_atcfSnaps[index];
   }
   auto operator[](size_t index) const -> const Gahm::Atcf::AtcfSnap& {
@@ -105,10 +124,26 @@ class AtcfFile {
 
   void addAtcfSnap(const Gahm::Atcf::AtcfSnap& snap);
 
+  NODISCARD auto revision() const -> uint64_t;
+
+  void markModified();
+
  private:
+  auto snapIndex(const Gahm::Datatypes::Date& date) -> size_t;
+
   std::string m_filename;
   bool m_quiet{false};
   std::vector<Gahm::Atcf::AtcfSnap> m_atcfSnaps;
+
+  //...Position of each snap in m_atcfSnaps keyed by its date in epoch
+  // milliseconds. Snaps appended through data() are picked up the next time
+  // the index is used, but snap dates should not be changed through data()
+  std::unordered_map<int64_t, size_t> m_date_index;
+  size_t m_indexed_snaps{0};
+
+  //...Incremented each time the snaps change so that objects built from the
+  // track know when to rebuild
+  uint64_t m_revision{0};
 };
 
 }  // namespace Gahm::Atcf
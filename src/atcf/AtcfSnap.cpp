@@ -26,15 +26,16 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include "AtcfIsotach.h"
 #include "StormPosition.h"
 #include "StormTranslation.h"
-#include "boost/algorithm/string/trim.hpp"
 #include "datatypes/CircularArray.h"
 #include "datatypes/Date.h"
+#include "date.hpp"
 #include "fmt/compile.h"
 #include "fmt/core.h"
 #include "physical/Atmospheric.h"
@@ -308,6 +309,17 @@ void AtcfSnap::addIsotach(const AtcfIsotach& isotach) {
  */
 auto AtcfSnap::parseAtcfSnap(const std::string& line)
     -> std::optional<AtcfSnap> {
+  return AtcfSnap::parseAtcfSnap(std::string_view(line));
+}
+
+/*
+ * Parses an ATCF snap from a view of a line in the ATCF format. The fields
+ * are read in place, so no strings are created other than the storm name
+ * @param line Line to parse
+ * @return ATCF snap
+ */
+auto AtcfSnap::parseAtcfSnap(std::string_view line)
+    -> std::optional<AtcfSnap> {
   constexpr double kt2ms = Gahm::Physical::Units::convert(
       Gahm::Physical::Units::Knot, Gahm::Physical::Units::MetersPerSecond);
   constexpr double nmi2m = Gahm::Physical::Units::convert(
@@ -315,32 +327,34 @@ auto AtcfSnap::parseAtcfSnap(const std::string& line)
 
   using namespace Gahm::detail::Utilities;
 
-  auto tokens = splitString(line);
-  if (tokens.size() < 27) {
+  t_atcf_tokens tokens;
+  const auto n_tokens = splitString(line, tokens);
+  if (n_tokens < 27) {
     //...The line is not valid
     return {};
   }
 
-  const auto snap_basin = AtcfSnap::basinFromString(tokens[0]);
+  const auto snap_basin = AtcfSnap::basinFromString(std::string(tokens[0]));
   const auto storm_id = readValueCheckBlank<int>(tokens[1]);
   const auto snap_date = AtcfSnap::parseDate(tokens[2], tokens[5]);
 
-  const auto lat = [&]() {
-    double l = stod(tokens[6].substr(0, tokens[6].size() - 1)) / 10.0;
-    if (*(tokens[6].rbegin()) == 'S') l *= -1.0;
+  const auto read_position = [](std::string_view token, char negative) {
+    token = trim(token);
+    if (token.empty()) return 0.0;
+    double l = readValueCheckBlank<double>(token.substr(0, token.size() - 1));
+    l /= 10.0;
+    if (token.back() == negative) l *= -1.0;
     return l;
-  }();
+  };
 
-  const auto lon = [&]() {
-    double l = stod(tokens[7].substr(0, tokens[7].size() - 1)) / 10.0;
-    if (*(tokens[7].rbegin()) == 'W') l *= -1.0;
-    return l;
-  }();
+  const auto lat = read_position(tokens[6], 'S');
+  const auto lon = read_position(tokens[7], 'W');
 
   const auto v_max = readValueCheckBlank<double>(tokens[8]) * kt2ms;
   const auto p_min = readValueCheckBlank<double>(tokens[9]) * 100.0;
   const auto r_max = readValueCheckBlank<double>(tokens[19]) * nmi2m;
-  const auto storm_name = boost::trim_copy(tokens[27]);
+  const auto storm_name =
+      n_tokens > 27 ? std::string(trim(tokens[27])) : std::string();
 
   auto snap = AtcfSnap(snap_basin, p_min,
                        Gahm::Physical::Constants::backgroundPressure() * 100.0,
@@ -354,12 +368,11 @@ auto AtcfSnap::parseAtcfSnap(const std::string& line)
 }
 
 /*
- * Parses an isotach from a vector of tokens
+ * Parses an isotach from the fields of an ATCF line
  * @param tokens Tokens to parse
  * @return Isotach parsed from the tokens
  */
-auto AtcfSnap::parseIsotach(const std::vector<std::string>& tokens)
-    -> AtcfIsotach {
+auto AtcfSnap::parseIsotach(const t_atcf_tokens& tokens) -> AtcfIsotach {
   using namespace Gahm::detail::Utilities;
   constexpr double kt2ms = Gahm::Physical::Units::convert(
       Gahm::Physical::Units::Knot, Gahm::Physical::Units::MetersPerSecond);
@@ -385,15 +398,45 @@ auto AtcfSnap::parseIsotach(const std::vector<std::string>& tokens)
 }
 
 /*
- * Parses the date from the ATCF snap
+ * Parses the date from the ATCF snap. The date field has the fixed format
+ * YYYYMMDDHH and is decoded directly. A field which is not a valid date gives
+ * the default date, which marks the snap as invalid
  * @param date_str Date string
  * @param tau_str Time string
  * @return Date
  */
-auto AtcfSnap::parseDate(const std::string& date_str,
-                         const std::string& tau_str) -> Gahm::Datatypes::Date {
-  auto base_date =
-      Gahm::Datatypes::Date::fromString(boost::trim_copy(date_str), "%Y%m%d%H");
+auto AtcfSnap::parseDate(std::string_view date_str, std::string_view tau_str)
+    -> Gahm::Datatypes::Date {
+  constexpr size_t date_length = 10;
+  constexpr int hours_per_day = 24;
+
+  date_str = Gahm::detail::Utilities::trim(date_str);
+  if (date_str.size() != date_length) return {};
+
+  const auto digits = [&](size_t position, size_t count) {
+    int value = 0;
+    for (size_t i = position; i < position + count; ++i) {
+      const char c = date_str[i];
+      if (c < '0' || c > '9') return -1;
+      value = value * 10 + (c - '0');
+    }
+    return value;
+  };
+
+  const auto year = digits(0, 4);
+  const auto month = digits(4, 2);
+  const auto day = digits(6, 2);
+  const auto hour = digits(8, 2);
+  if (year < 0 || month < 0 || day < 0 || hour < 0 || hour >= hours_per_day) {
+    return {};
+  }
+
+  const auto ymd = date::year(year) / date::month(static_cast<unsigned>(month)) /
+                   date::day(static_cast<unsigned>(day));
+  if (!ymd.ok()) return {};
+
+  auto base_date = Gahm::Datatypes::Date(year, static_cast<unsigned>(month),
+                                         static_cast<unsigned>(day), hour);
   const auto tau = Gahm::detail::Utilities::readValueCheckBlank<int>(tau_str);
   base_date.addHours(tau);
   return base_date;
@@ -554,10 +597,12 @@ auto AtcfSnap::to_string(size_t cycle, const Gahm::Datatypes::Date& start_date,
 /**
  * @brief Get the radii of the isotachs in each quadrant.
  * This preprocessing allows all of the data to be ready
- * for the solver in a friendly manner
+ * for the solver in a friendly manner. Any radii from a previous call are
+ * replaced, so the snap can be processed again after it changes
  */
 void AtcfSnap::processIsotachRadii() {
-  for (int i = 0; i < m_radii.size(); ++i) {
+  for (int i = 0; i < static_cast<int>(m_radii.size()); ++i) {
+    m_radii[i].clear();
     for (auto& isotach : m_isotachs) {
       m_radii[i].push_back(isotach.quadrant(i).isotachRadius());
     }
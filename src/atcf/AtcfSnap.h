@@ -21,9 +21,11 @@
 #ifndef GAHM_SRC_ATCFSNAP_H_
 #define GAHM_SRC_ATCFSNAP_H_
 
+#include <array>
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "atcf/AtcfIsotach.h"
@@ -57,6 +59,10 @@ class AtcfSnap {
 
   static auto parseAtcfSnap(const std::string& line) -> std::optional<AtcfSnap>;
 
+#ifndef SWIG
+  static auto parseAtcfSnap(std::string_view line) -> std::optional<AtcfSnap>;
+#endif
+
   NODISCARD auto centralPressure() const -> double;
   void setCentralPressure(double centralPressure);
 
@@ -126,11 +132,17 @@ class AtcfSnap {
   void orderIsotachs();
 
  private:
-  static auto parseDate(const std::string& date_str, const std::string& tau_str)
+#ifndef SWIG
+  //...Number of leading fields of an ATCF line used by the parser
+  static constexpr size_t c_atcf_fields = 28;
+  using t_atcf_tokens = std::array<std::string_view, c_atcf_fields>;
+
+  static auto parseDate(std::string_view date_str, std::string_view tau_str)
       -> Gahm::Datatypes::Date;
 
-  static auto parseIsotach(const std::vector<std::string>& line)
+  static auto parseIsotach(const t_atcf_tokens& tokens)
       -> Gahm::Atcf::AtcfIsotach;
+#endif
 
   double m_central_pressure;
   double m_background_pressure;
@@ -0,0 +1,146 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "CompiledTrack.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+
+#include "atcf/AtcfFile.h"
+#include "atcf/AtcfSnap.h"
+
+namespace Gahm::Atcf {
+
+/**
+ * Constructor that flattens a preprocessed AtcfFile into the compiled track
+ * @param atcf AtcfFile to compile. The preprocessor must have been run
+ */
+CompiledTrack::CompiledTrack(const Gahm::Atcf::AtcfFile &atcf)
+    : m_snap_count(atcf.size()) {
+  for (const auto &snap : atcf.data()) {
+    m_stride = std::max(m_stride, snap.isotachCount());
+  }
+
+  m_isotach_count.reserve(m_snap_count);
+  m_epoch_seconds.reserve(m_snap_count);
+  m_position.reserve(m_snap_count);
+  m_translation.reserve(m_snap_count);
+  m_central_pressure.reserve(m_snap_count);
+  m_background_pressure.reserve(m_snap_count);
+  m_outermost_isotach_radius.reserve(m_snap_count);
+
+  const size_t n_values = m_snap_count * c_quadrant_count * m_stride;
+  m_isotach_radius.resize(n_values, 0.0);
+  m_radius_to_max_winds.resize(n_values, 0.0);
+  m_holland_b.resize(n_values, 0.0);
+  m_vmax_at_boundary_layer.resize(n_values, 0.0);
+  m_isotach_speed_at_boundary_layer.resize(n_values, 0.0);
+
+  for (size_t snap_index = 0; snap_index < m_snap_count; ++snap_index) {
+    const auto &snap = atcf.data()[snap_index];
+    m_isotach_count.push_back(snap.isotachCount());
+    m_epoch_seconds.push_back(snap.date().toSeconds());
+    m_position.push_back(snap.position());
+    m_translation.push_back(snap.translation());
+    m_central_pressure.push_back(snap.centralPressure());
+    m_background_pressure.push_back(snap.backgroundPressure());
+
+    double outermost_radius = 0.0;
+    for (size_t quadrant = 0; quadrant < c_quadrant_count; ++quadrant) {
+      for (size_t isotach = 0; isotach < snap.isotachCount(); ++isotach) {
+        const auto &q =
+            snap.isotachs()[isotach].quadrant(static_cast<int>(quadrant));
+        const auto idx =
+            this->index(snap_index, static_cast<int>(quadrant), isotach);
+        m_isotach_radius[idx] = q.isotachRadius();
+        m_radius_to_max_winds[idx] = q.radiusToMaxWindSpeed();
+        m_holland_b[idx] = q.gahmHollandB();
+        m_vmax_at_boundary_layer[idx] = q.vmaxAtBoundaryLayer();
+        m_isotach_speed_at_boundary_layer[idx] =
+            q.isotachSpeedAtBoundaryLayer();
+        outermost_radius = std::max(outermost_radius, q.isotachRadius());
+      }
+    }
+    m_outermost_isotach_radius.push_back(outermost_radius);
+  }
+}
+
+/**
+ * Finds the isotach that bounds the given distance from below in a quadrant
+ * and the weight of the distance between it and the next isotach
+ * @param snap Snap index
+ * @param quadrant Quadrant index. Values outside [0, 3] are wrapped
+ * @param distance Distance from the storm center
+ * @return Isotach index and the weight toward the next isotach
+ */
+auto CompiledTrack::isotachBracket(size_t snap, int quadrant,
+                                   double distance) const
+    -> std::tuple<size_t, double> {
+  const auto count = m_isotach_count[snap];
+  const auto offset =
+      static_cast<std::ptrdiff_t>(this->index(snap, quadrant, 0));
+  const auto first = m_isotach_radius.begin() + offset;
+  const auto last = first + static_cast<std::ptrdiff_t>(count);
+
+  if (distance >= *std::prev(last)) {
+    return {count - 1, 1.0};
+  } else if (distance <= *first) {
+    return {0, 0.0};
+  } else {
+    const auto isotach_it = std::lower_bound(first, last, distance);
+    const auto prev_isotach_it = std::prev(isotach_it);
+    const auto isotach_index =
+        static_cast<size_t>(std::distance(first, prev_isotach_it));
+    const double isotach_weight =
+        (distance - *prev_isotach_it) / (*isotach_it - *prev_isotach_it);
+    return {isotach_index, isotach_weight};
+  }
+}
+
+/**
+ * Finds the isotach bracket for the distance, checking the bracket that starts
+ * at the hinted isotach first. When the distance lies strictly between the
+ * hinted isotach and the next one, the bracket is returned without a search.
+ * Otherwise, the bracket is searched for as usual, so the result is always
+ * the same as the one without a hint
+ * @param snap Snap index
+ * @param quadrant Quadrant index. Values outside [0, 3] are wrapped
+ * @param distance Distance from the storm center
+ * @param hint Isotach index returned by a previous call, usually for a nearby
+ * distance
+ * @return Isotach index and the weight toward the next isotach
+ */
+auto CompiledTrack::isotachBracket(size_t snap, int quadrant, double distance,
+                                   size_t hint) const
+    -> std::tuple<size_t, double> {
+  if (hint + 1 < m_isotach_count[snap]) {
+    const auto idx = this->index(snap, quadrant, hint);
+    const double r0 = m_isotach_radius[idx];
+    const double r1 = m_isotach_radius[idx + 1];
+    if (r0 < distance && distance < r1) {
+      return {hint, (distance - r0) / (r1 - r0)};
+    }
+  }
+  return this->isotachBracket(snap, quadrant, distance);
+}
+
+}  // namespace Gahm::Atcf
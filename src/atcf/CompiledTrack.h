@@ -0,0 +1,156 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_ATCF_COMPILEDTRACK_H_
+#define GAHM_SRC_ATCF_COMPILEDTRACK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "atcf/StormPosition.h"
+#include "atcf/StormTranslation.h"
+
+#ifdef SWIG
+#define NODISCARD
+#else
+#define NODISCARD [[nodiscard]]
+#endif
+
+namespace Gahm::Atcf {
+
+class AtcfFile;
+
+/**
+ * @brief Immutable, flattened copy of a preprocessed storm track
+ *
+ * The per-isotach parameters of every snap are stored in contiguous arrays
+ * with a fixed stride so that the solver can look them up without walking
+ * the AtcfSnap -> AtcfIsotach -> AtcfQuadrant object graph. Values are laid
+ * out as [snap][quadrant][isotach], where the isotach dimension is padded to
+ * the largest isotach count found in the track.
+ *
+ * The track must be compiled after the preprocessor has been run since the
+ * radius to max winds and Holland B values are read from the solved isotachs.
+ */
+class CompiledTrack {
+ public:
+  static constexpr size_t c_quadrant_count = 4;
+
+  CompiledTrack() = default;
+
+  explicit CompiledTrack(const Gahm::Atcf::AtcfFile &atcf);
+
+  NODISCARD auto snapCount() const -> size_t { return m_snap_count; }
+
+  NODISCARD auto maxIsotachCount() const -> size_t { return m_stride; }
+
+  NODISCARD auto isotachCount(size_t snap) const -> size_t {
+    return m_isotach_count[snap];
+  }
+
+  NODISCARD auto epochSeconds(size_t snap) const -> int64_t {
+    return m_epoch_seconds[snap];
+  }
+
+  NODISCARD auto position(size_t snap) const -> const StormPosition & {
+    return m_position[snap];
+  }
+
+  NODISCARD auto translation(size_t snap) const -> const StormTranslation & {
+    return m_translation[snap];
+  }
+
+  NODISCARD auto centralPressure(size_t snap) const -> double {
+    return m_central_pressure[snap];
+  }
+
+  NODISCARD auto backgroundPressure(size_t snap) const -> double {
+    return m_background_pressure[snap];
+  }
+
+  NODISCARD auto outermostIsotachRadius(size_t snap) const -> double {
+    return m_outermost_isotach_radius[snap];
+  }
+
+  NODISCARD auto index(size_t snap, int quadrant, size_t isotach) const
+      -> size_t {
+    return (snap * c_quadrant_count + wrapQuadrant(quadrant)) * m_stride +
+           isotach;
+  }
+
+  NODISCARD auto isotachRadius(size_t idx) const -> double {
+    return m_isotach_radius[idx];
+  }
+
+  NODISCARD auto radiusToMaxWinds(size_t idx) const -> double {
+    return m_radius_to_max_winds[idx];
+  }
+
+  NODISCARD auto hollandB(size_t idx) const -> double {
+    return m_holland_b[idx];
+  }
+
+  NODISCARD auto vmaxAtBoundaryLayer(size_t idx) const -> double {
+    return m_vmax_at_boundary_layer[idx];
+  }
+
+  NODISCARD auto isotachSpeedAtBoundaryLayer(size_t idx) const -> double {
+    return m_isotach_speed_at_boundary_layer[idx];
+  }
+
+  NODISCARD auto isotachBracket(size_t snap, int quadrant,
+                                double distance) const
+      -> std::tuple<size_t, double>;
+
+  NODISCARD auto isotachBracket(size_t snap, int quadrant, double distance,
+                                size_t hint) const
+      -> std::tuple<size_t, double>;
+
+  NODISCARD static constexpr auto wrapQuadrant(int quadrant) -> size_t {
+    return static_cast<size_t>(
+        ((quadrant % static_cast<int>(c_quadrant_count)) +
+         static_cast<int>(c_quadrant_count)) %
+        static_cast<int>(c_quadrant_count));
+  }
+
+ private:
+  size_t m_snap_count{0};
+  size_t m_stride{0};
+
+  std::vector<size_t> m_isotach_count;
+  std::vector<int64_t> m_epoch_seconds;
+  std::vector<StormPosition> m_position;
+  std::vector<StormTranslation> m_translation;
+  std::vector<double> m_central_pressure;
+  std::vector<double> m_background_pressure;
+  std::vector<double> m_outermost_isotach_radius;
+
+  std::vector<double> m_isotach_radius;
+  std::vector<double> m_radius_to_max_winds;
+  std::vector<double> m_holland_b;
+  std::vector<double> m_vmax_at_boundary_layer;
+  std::vector<double> m_isotach_speed_at_boundary_layer;
+};
+
+}  // namespace Gahm::Atcf
+
+#endif  // GAHM_SRC_ATCF_COMPILEDTRACK_H_
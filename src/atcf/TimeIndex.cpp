@@ -0,0 +1,135 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "TimeIndex.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "atcf/CompiledTrack.h"
+
+namespace Gahm::Atcf {
+
+/**
+ * Constructor
+ * @param times Snap times in epoch seconds, in increasing order
+ */
+TimeIndex::TimeIndex(std::vector<int64_t> times) : m_times(std::move(times)) {
+  if (m_times.empty()) {
+    throw std::invalid_argument("Time index requires at least one time");
+  }
+  if (!std::is_sorted(m_times.begin(), m_times.end())) {
+    throw std::invalid_argument("Time index times must be in increasing order");
+  }
+}
+
+/**
+ * Constructor that reads the snap times from a compiled track
+ * @param track Compiled track
+ */
+TimeIndex::TimeIndex(const CompiledTrack &track)
+    : TimeIndex([&track]() {
+        std::vector<int64_t> times(track.snapCount());
+        for (size_t i = 0; i < times.size(); ++i) {
+          times[i] = track.epochSeconds(i);
+        }
+        return times;
+      }()) {}
+
+/**
+ * Finds the snaps that bracket a time. The interval found is kept as the
+ * cursor, and the next call checks the cursor interval and the one after it
+ * before searching, so increasing times are found in constant time
+ * @param time Time in epoch seconds
+ * @return Index of the earlier snap and the weight toward the next snap. Times
+ * before the first snap return the first snap with a weight of zero and times
+ * after the last snap return the last snap with a weight of one
+ */
+auto TimeIndex::find(const int64_t time) -> std::tuple<size_t, double> {
+  if (time <= m_times.front()) return {0, 0.0};
+  if (time >= m_times.back()) return {m_times.size() - 1, 1.0};
+
+  if (!this->contains(m_cursor, time)) {
+    if (this->contains(m_cursor + 1, time)) {
+      m_cursor++;
+    } else {
+      m_cursor = this->searchInterval(time);
+    }
+  }
+  return this->bracket(m_cursor, time);
+}
+
+/**
+ * Finds the snaps that bracket a time with a binary search, without using or
+ * moving the cursor
+ * @param time Time in epoch seconds
+ * @return Index of the earlier snap and the weight toward the next snap, see
+ * find()
+ */
+auto TimeIndex::search(const int64_t time) const
+    -> std::tuple<size_t, double> {
+  if (time <= m_times.front()) return {0, 0.0};
+  if (time >= m_times.back()) return {m_times.size() - 1, 1.0};
+  return this->bracket(this->searchInterval(time), time);
+}
+
+/**
+ * Returns true if the time falls in (time[interval], time[interval + 1]]
+ * @param interval Interval index
+ * @param time Time in epoch seconds
+ * @return True if the interval contains the time
+ */
+auto TimeIndex::contains(const size_t interval, const int64_t time) const
+    -> bool {
+  return interval + 1 < m_times.size() && m_times[interval] < time &&
+         time <= m_times[interval + 1];
+}
+
+/**
+ * Computes the weight of a time within an interval
+ * @param interval Interval index
+ * @param time Time in epoch seconds
+ * @return Interval index and the weight toward the end of the interval
+ */
+auto TimeIndex::bracket(const size_t interval, const int64_t time) const
+    -> std::tuple<size_t, double> {
+  const double weight =
+      static_cast<double>(time - m_times[interval]) /
+      static_cast<double>(m_times[interval + 1] - m_times[interval]);
+  return {interval, weight};
+}
+
+/**
+ * Finds the interval containing a time that is strictly inside of the index
+ * @param time Time in epoch seconds
+ * @return Interval index
+ */
+auto TimeIndex::searchInterval(const int64_t time) const -> size_t {
+  const auto it = std::lower_bound(m_times.begin(), m_times.end(), time);
+  return static_cast<size_t>(std::distance(m_times.begin(), it)) - 1;
+}
+
+}  // namespace Gahm::Atcf
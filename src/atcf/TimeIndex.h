@@ -0,0 +1,78 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_ATCF_TIMEINDEX_H_
+#define GAHM_SRC_ATCF_TIMEINDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#ifdef SWIG
+#define NODISCARD
+#else
+#define NODISCARD [[nodiscard]]
+#endif
+
+namespace Gahm::Atcf {
+
+class CompiledTrack;
+
+/**
+ * @brief Index of the snap times of a track for finding the snaps that
+ * bracket a time
+ *
+ * The snap times are stored as epoch seconds in a contiguous array. The index
+ * keeps a cursor at the interval found by the last call to find(), so a
+ * sequence of increasing times, as in a model time stepping loop, is resolved
+ * by checking the current and next intervals instead of searching
+ */
+class TimeIndex {
+ public:
+  TimeIndex() = default;
+
+  explicit TimeIndex(std::vector<int64_t> times);
+
+  explicit TimeIndex(const CompiledTrack &track);
+
+  NODISCARD auto size() const -> size_t { return m_times.size(); }
+
+  NODISCARD auto time(size_t index) const -> int64_t { return m_times[index]; }
+
+  NODISCARD auto cursor() const -> size_t { return m_cursor; }
+
+  auto find(int64_t time) -> std::tuple<size_t, double>;
+
+  NODISCARD auto search(int64_t time) const -> std::tuple<size_t, double>;
+
+ private:
+  NODISCARD auto contains(size_t interval, int64_t time) const -> bool;
+  NODISCARD auto bracket(size_t interval, int64_t time) const
+      -> std::tuple<size_t, double>;
+  NODISCARD auto searchInterval(int64_t time) const -> size_t;
+
+  std::vector<int64_t> m_times;
+  size_t m_cursor{0};
+};
+
+}  // namespace Gahm::Atcf
+
+#endif  // GAHM_SRC_ATCF_TIMEINDEX_H_
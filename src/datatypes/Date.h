@@ -23,6 +23,7 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <ratio>
 #include <string>
@@ -61,7 +62,7 @@ class Date {
   using months = std::chrono::duration<
       int, std::ratio_divide<years::period, std::ratio<months_per_year>>>;
 
-  Date();
+  constexpr Date() = default;
 
   explicit Date(long long secondsSinceEpoch);
 
@@ -73,29 +74,38 @@ class Date {
                 long long minute = 0, long long second = 0,
                 long long millisecond = 0);
 
-  Date(const Date &d);
-
   //...operator overloads
 #ifndef SWIG
-  auto operator<(const Date &d) const -> bool;
-  auto operator>(const Date &d) const -> bool;
-  auto operator<=(const Date &d) const -> bool;
-  auto operator>=(const Date &d) const -> bool;
-  auto operator==(const Date &d) const -> bool;
-  auto operator!=(const Date &d) const -> bool;
-  auto operator=(const Date &d) -> Date & = default;
+  constexpr auto operator<(const Date &d) const -> bool {
+    return m_milliseconds < d.m_milliseconds;
+  }
+  constexpr auto operator>(const Date &d) const -> bool {
+    return m_milliseconds > d.m_milliseconds;
+  }
+  constexpr auto operator<=(const Date &d) const -> bool {
+    return m_milliseconds <= d.m_milliseconds;
+  }
+  constexpr auto operator>=(const Date &d) const -> bool {
+    return m_milliseconds >= d.m_milliseconds;
+  }
+  constexpr auto operator==(const Date &d) const -> bool {
+    return m_milliseconds == d.m_milliseconds;
+  }
+  constexpr auto operator!=(const Date &d) const -> bool {
+    return m_milliseconds != d.m_milliseconds;
+  }
 
   template <class T, std::enable_if_t<std::is_integral_v<T>> * = nullptr>
   auto operator+=(const T &rhs) -> Date & {
-    this->m_datetime += Date::seconds(rhs);
+    this->m_milliseconds += Date::toMilliseconds(Date::seconds(rhs));
     return *this;
   }
 
   template <class T, std::enable_if_t<std::is_floating_point_v<T>> * = nullptr>
   auto operator+=(const T &rhs) -> Date & {
     constexpr int milliseconds_per_second = 1000;
-    this->m_datetime += Date::milliseconds(
-        static_cast<long>(std::floor(rhs * milliseconds_per_second)));
+    this->m_milliseconds += static_cast<int64_t>(
+        std::floor(rhs * milliseconds_per_second));
     return *this;
   }
 
@@ -105,7 +115,7 @@ class Date {
                        !std::is_same_v<T, Date::years> &&
                        !std::is_same_v<T, Date::months>> * = nullptr>
   auto operator+=(const T &rhs) -> Date & {
-    this->m_datetime += rhs;
+    this->m_milliseconds += Date::toMilliseconds(rhs);
     return *this;
   }
 
@@ -114,15 +124,15 @@ class Date {
 
   template <class T, std::enable_if_t<std::is_integral_v<T>> * = nullptr>
   auto operator-=(const T &rhs) -> Date & {
-    this->m_datetime -= Date::seconds(rhs);
+    this->m_milliseconds -= Date::toMilliseconds(Date::seconds(rhs));
     return *this;
   }
 
   template <class T, std::enable_if_t<std::is_floating_point_v<T>> * = nullptr>
   auto operator-=(const T &rhs) -> Date & {
     constexpr int milliseconds_per_second = 1000;
-    this->m_datetime -= Date::milliseconds(
-        static_cast<long>(std::floor(rhs * milliseconds_per_second)));
+    this->m_milliseconds -= static_cast<int64_t>(
+        std::floor(rhs * milliseconds_per_second));
     return *this;
   }
 
@@ -132,7 +142,7 @@ class Date {
                        !std::is_same_v<T, Date::years> &&
                        !std::is_same_v<T, Date::months>> * = nullptr>
   auto operator-=(const T &rhs) -> Date & {
-    this->m_datetime -= rhs;
+    this->m_milliseconds -= Date::toMilliseconds(rhs);
     return *this;
   }
 
@@ -173,7 +183,9 @@ class Date {
 
   NODISCARD auto toSeconds() const -> long;
 
-  NODISCARD auto toMSeconds() const -> long long;
+  NODISCARD constexpr auto toMSeconds() const -> long long {
+    return m_milliseconds;
+  }
 
   NODISCARD auto year() const -> int;
   void setYear(int year);
@@ -208,7 +220,23 @@ class Date {
   static auto now() -> Date;
 
  private:
-  std::chrono::system_clock::time_point m_datetime;
+  /**
+   * Converts a duration to whole milliseconds, rounding toward negative
+   * infinity so that sub-millisecond durations behave the same on either
+   * side of the epoch
+   * @param d Duration to convert
+   * @return Number of milliseconds
+   */
+  template <class Rep, class Period>
+  static constexpr auto toMilliseconds(
+      const std::chrono::duration<Rep, Period> &d) -> int64_t {
+    return std::chrono::floor<Date::milliseconds>(d).count();
+  }
+
+  //...The date is held as a single count of milliseconds since
+  // 1970-01-01 00:00:00 so that copies and comparisons are plain integer
+  // operations. The calendar fields are computed from it when requested
+  int64_t m_milliseconds{0};
 };
 
 template <typename T>
@@ -24,9 +24,12 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include "datatypes/Point.h"
+#include "datatypes/PointIndex.h"
 
 #ifdef SWIG
 #define NODISCARD
@@ -70,29 +73,87 @@ class PointCloud {
   }
 
   void addPoint(const Gahm::Datatypes::Point &point) {
+    m_index.reset();
     m_points.push_back(point);
   }
 
   void addPoint(double x_pos, double y_pos) {
+    m_index.reset();
     m_points.emplace_back(x_pos, y_pos);
   }
 
-  void clear() { m_points.clear(); }
+  void clear() {
+    m_index.reset();
+    m_points.clear();
+  }
 
   void removePoint(const Gahm::Datatypes::Point &point) {
     auto iter = std::find(m_points.begin(), m_points.end(), point);
     if (iter != m_points.end()) {
+      m_index.reset();
       m_points.erase(iter);
     }
   }
 
+  /**
+   * @brief Builds the spatial index used by the range queries. The index is
+   * shared between copies of the point cloud and is discarded whenever the
+   * points are modified
+   * @param bucket_size Size of the index buckets in degrees. Zero chooses a
+   * size from the extent and number of points
+   */
+  void buildIndex(double bucket_size = 0.0) {
+    m_index = std::make_shared<const PointIndex>(m_points, bucket_size);
+  }
+
+  NODISCARD auto hasIndex() const -> bool { return m_index != nullptr; }
+
+#ifndef SWIG
+  NODISCARD auto index() const -> std::shared_ptr<const PointIndex> {
+    return m_index;
+  }
+#endif
+
+  /**
+   * @brief Returns the indices of the points within a radius of a location.
+   * Requires that buildIndex() has been called
+   * @param x Longitude of the location
+   * @param y Latitude of the location
+   * @param radius Search radius in meters
+   * @return Indices of the points within the radius
+   */
+  NODISCARD auto queryRadius(double x, double y, double radius) const
+      -> std::vector<size_t> {
+    return this->checkedIndex().queryRadius(x, y, radius);
+  }
+
+  /**
+   * @brief Returns the indices of the points inside a bounding box. Requires
+   * that buildIndex() has been called
+   * @param x_min Minimum longitude
+   * @param y_min Minimum latitude
+   * @param x_max Maximum longitude
+   * @param y_max Maximum latitude
+   * @return Indices of the points inside the bounding box
+   */
+  NODISCARD auto queryBoundingBox(double x_min, double y_min, double x_max,
+                                  double y_max) const -> std::vector<size_t> {
+    return this->checkedIndex().queryBoundingBox(x_min, y_min, x_max, y_max);
+  }
+
   void reserve(size_t size) { m_points.reserve(size); }
 
 #ifndef SWIG
-  auto begin() { return m_points.begin(); }
+  auto begin() {
+    m_index.reset();
+    return m_points.begin();
+  }
   NODISCARD auto begin() const { return m_points.begin(); }
 
-  auto end() { return m_points.end(); }
+  auto end() {
+    m_index.reset();
+    return m_points.end();
+  }
   NODISCARD auto end() const { return m_points.end(); }
 
   auto front() { return m_points.front(); }
@@ -112,6 +173,7 @@ class PointCloud {
   }
 
   NODISCARD auto operator[](size_t index) -> Gahm::Datatypes::Point & {
+    m_index.reset();
     return m_points[index];
   }
   NODISCARD auto operator[](size_t index) const
@@ -126,7 +188,16 @@ class PointCloud {
   NODISCARD auto empty() const -> bool { return m_points.empty(); }
 
  private:
+  NODISCARD auto checkedIndex() const -> const PointIndex & {
+    if (!m_index) {
+      throw std::runtime_error(
+          "The point cloud index has not been built. Call buildIndex() first");
+    }
+    return *m_index;
+  }
+
   std::vector<Gahm::Datatypes::Point> m_points;
+  std::shared_ptr<const PointIndex> m_index;
 };
 
 }  // namespace Gahm::Datatypes
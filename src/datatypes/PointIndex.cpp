@@ -0,0 +1,300 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "PointIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include "physical/Constants.h"
+#include "physical/Earth.h"
+
+namespace Gahm::Datatypes {
+
+//...Target average number of points in each bucket when the bucket size is
+// chosen automatically
+constexpr double c_target_points_per_bucket = 16.0;
+
+//...Smallest bucket size that will be chosen automatically, in degrees
+constexpr double c_min_bucket_size = 1.0e-4;
+
+/**
+ * Constructor that builds the bucket index for a set of points
+ * @param points Points to index
+ * @param bucket_size Size of the buckets in degrees. If zero or negative, the
+ * bucket size is chosen from the extent and number of the points
+ */
+PointIndex::PointIndex(const std::vector<Gahm::Datatypes::Point> &points,
+                       double bucket_size)
+    : m_bucket_size(1.0),
+      m_x_min(0.0),
+      m_y_min(0.0),
+      m_x_max(0.0),
+      m_y_max(0.0),
+      m_nx(1),
+      m_ny(1) {
+  const size_t n_points = points.size();
+  if (n_points == 0) {
+    m_bucket_offset.assign(2, 0);
+    return;
+  }
+
+  auto [x_min_it, x_max_it] = std::minmax_element(
+      points.begin(), points.end(),
+      [](const Point &a, const Point &b) { return a.x() < b.x(); });
+  auto [y_min_it, y_max_it] = std::minmax_element(
+      points.begin(), points.end(),
+      [](const Point &a, const Point &b) { return a.y() < b.y(); });
+  m_x_min = x_min_it->x();
+  m_y_min = y_min_it->y();
+  m_x_max = x_max_it->x();
+  m_y_max = y_max_it->y();
+  const double width = x_max_it->x() - m_x_min;
+  const double height = y_max_it->y() - m_y_min;
+
+  if (bucket_size <= 0.0) {
+    const double area = std::max(width, c_min_bucket_size) *
+                        std::max(height, c_min_bucket_size);
+    bucket_size = std::max(
+        c_min_bucket_size,
+        std::sqrt(area * c_target_points_per_bucket /
+                  static_cast<double>(n_points)));
+  }
+
+  //...Limit the number of buckets so that the offset array stays
+  // proportional to the number of points
+  const double max_buckets = 4.0 * static_cast<double>(n_points) + 16.0;
+  while ((std::floor(width / bucket_size) + 1.0) *
+             (std::floor(height / bucket_size) + 1.0) >
+         max_buckets) {
+    bucket_size *= 2.0;
+  }
+
+  m_bucket_size = bucket_size;
+  m_nx = static_cast<size_t>(std::floor(width / m_bucket_size)) + 1;
+  m_ny = static_cast<size_t>(std::floor(height / m_bucket_size)) + 1;
+
+  //...Counting sort of the points into the buckets. Points keep their
+  // original order within each bucket
+  std::vector<size_t> point_bucket(n_points);
+  m_bucket_offset.assign(m_nx * m_ny + 1, 0);
+  for (size_t i = 0; i < n_points; ++i) {
+    point_bucket[i] =
+        this->bucketY(points[i].y()) * m_nx + this->bucketX(points[i].x());
+    m_bucket_offset[point_bucket[i] + 1]++;
+  }
+  for (size_t b = 0; b < m_nx * m_ny; ++b) {
+    m_bucket_offset[b + 1] += m_bucket_offset[b];
+  }
+
+  std::vector<size_t> position(m_bucket_offset.begin(),
+                               m_bucket_offset.end() - 1);
+  m_bucket_points.resize(n_points);
+  m_bucket_x.resize(n_points);
+  m_bucket_y.resize(n_points);
+  for (size_t i = 0; i < n_points; ++i) {
+    const size_t slot = position[point_bucket[i]]++;
+    m_bucket_points[slot] = i;
+    m_bucket_x[slot] = points[i].x();
+    m_bucket_y[slot] = points[i].y();
+  }
+}
+
+/**
+ * Returns the bucket column containing a longitude, clamped to the grid
+ * @param x Longitude
+ * @return Bucket column
+ */
+auto PointIndex::bucketX(double x) const -> size_t {
+  const double bx = std::floor((x - m_x_min) / m_bucket_size);
+  if (!(bx > 0.0)) return 0;
+  if (bx >= static_cast<double>(m_nx - 1)) return m_nx - 1;
+  return static_cast<size_t>(bx);
+}
+
+/**
+ * Returns the bucket row containing a latitude, clamped to the grid
+ * @param y Latitude
+ * @return Bucket row
+ */
+auto PointIndex::bucketY(double y) const -> size_t {
+  const double by = std::floor((y - m_y_min) / m_bucket_size);
+  if (!(by > 0.0)) return 0;
+  if (by >= static_cast<double>(m_ny - 1)) return m_ny - 1;
+  return static_cast<size_t>(by);
+}
+
+/**
+ * Calls a function for every point inside the bounding box of a radius around
+ * a location. The box is searched as given and shifted by 360 degrees each
+ * way, so it wraps across the antimeridian and matches points stored in either
+ * longitude convention. A box which spans every longitude is searched once
+ * @param x Longitude of the location
+ * @param y Latitude of the location
+ * @param radius Search radius in meters
+ * @param function Function called with the position of each point in the
+ * bucket arrays
+ */
+template <typename Function>
+void PointIndex::forEachInRadiusBoundingBox(double x, double y, double radius,
+                                            const Function &function) const {
+  const auto [x_min, y_min, x_max, y_max] =
+      PointIndex::radiusBoundingBox(x, y, radius);
+  if (x_max - x_min >= 360.0) {
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+    this->forEachInBoundingBox(-infinity, y_min, infinity, y_max, function);
+    return;
+  }
+
+  //...The shifted boxes are narrower than 360 degrees, so they do not overlap
+  // and no point is visited twice
+  for (const double shift : {-360.0, 0.0, 360.0}) {
+    this->forEachInBoundingBox(x_min + shift, y_min, x_max + shift, y_max,
+                               function);
+  }
+}
+
+/**
+ * Returns the indices of the points inside a bounding box
+ * @param x_min Minimum longitude
+ * @param y_min Minimum latitude
+ * @param x_max Maximum longitude
+ * @param y_max Maximum latitude
+ * @return Indices of the points inside the bounding box
+ */
+auto PointIndex::queryBoundingBox(double x_min, double y_min, double x_max,
+                                  double y_max) const -> std::vector<size_t> {
+  std::vector<size_t> result;
+  this->queryBoundingBox(x_min, y_min, x_max, y_max, result);
+  return result;
+}
+
+/**
+ * Writes the indices of the points inside a bounding box into an existing
+ * vector, replacing its contents
+ * @param x_min Minimum longitude
+ * @param y_min Minimum latitude
+ * @param x_max Maximum longitude
+ * @param y_max Maximum latitude
+ * @param result Vector to write the point indices into
+ */
+void PointIndex::queryBoundingBox(double x_min, double y_min, double x_max,
+                                  double y_max,
+                                  std::vector<size_t> &result) const {
+  result.clear();
+  this->forEachInBoundingBox(x_min, y_min, x_max, y_max, [&](const size_t k) {
+    result.push_back(m_bucket_points[k]);
+  });
+}
+
+/**
+ * Returns the indices of the points within a distance of a location
+ * @param x Longitude of the location
+ * @param y Latitude of the location
+ * @param radius Search radius in meters
+ * @return Indices of the points within the search radius
+ */
+auto PointIndex::queryRadius(double x, double y, double radius) const
+    -> std::vector<size_t> {
+  std::vector<size_t> result;
+  this->queryRadius(x, y, radius, result);
+  return result;
+}
+
+/**
+ * Writes the indices of the points within a distance of a location into an
+ * existing vector, replacing its contents
+ * @param x Longitude of the location
+ * @param y Latitude of the location
+ * @param radius Search radius in meters
+ * @param result Vector to write the point indices into
+ */
+void PointIndex::queryRadius(double x, double y, double radius,
+                             std::vector<size_t> &result) const {
+  result.clear();
+  this->forEachInRadiusBoundingBox(x, y, radius, [&](const size_t k) {
+    if (Physical::Earth::distance(m_bucket_x[k], m_bucket_y[k], x, y) <=
+        radius) {
+      result.push_back(m_bucket_points[k]);
+    }
+  });
+}
+
+/**
+ * Writes the indices of the points inside the bounding box of a radius around
+ * a location into an existing vector, replacing its contents. Every point
+ * within the radius is included, along with points in the corners of the box,
+ * so the caller can apply its own distance test
+ * @param x Longitude of the location
+ * @param y Latitude of the location
+ * @param radius Search radius in meters
+ * @param result Vector to write the point indices into
+ */
+void PointIndex::queryRadiusBoundingBox(double x, double y, double radius,
+                                        std::vector<size_t> &result) const {
+  result.clear();
+  this->forEachInRadiusBoundingBox(x, y, radius, [&](const size_t k) {
+    result.push_back(m_bucket_points[k]);
+  });
+}
+
+/**
+ * Computes a longitude/latitude bounding box that contains every point within
+ * a distance of a location. The box is conservative: it uses the polar radius
+ * of the earth, which is the smallest radius used by Earth::distance
+ * @param x Longitude of the location
+ * @param y Latitude of the location
+ * @param radius Radius in meters
+ * @return Tuple of the minimum longitude, minimum latitude, maximum longitude
+ * and maximum latitude
+ */
+auto PointIndex::radiusBoundingBox(double x, double y, double radius)
+    -> std::tuple<double, double, double, double> {
+  constexpr double deg2rad = Physical::Constants::deg2rad();
+  constexpr double rad2deg = Physical::Constants::rad2deg();
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+
+  //...Small padding in degrees to guard against round-off at the edges
+  constexpr double padding = 1.0e-6;
+
+  //...Angular radius of the spherical cap
+  const double angle = radius / Physical::Earth::polarRadius();
+  const double y_min = y - angle * rad2deg - padding;
+  const double y_max = y + angle * rad2deg + padding;
+
+  //...When the cap reaches a pole, or wraps the entire sphere, all
+  // longitudes must be searched
+  const double cos_lat = std::cos(y * deg2rad);
+  if (angle >= Physical::Constants::pi() || y_max >= 90.0 || y_min <= -90.0 ||
+      std::sin(angle) >= cos_lat) {
+    return {-infinity, std::max(y_min, -90.0), infinity,
+            std::min(y_max, 90.0)};
+  }
+
+  const double delta_lon = std::asin(std::sin(angle) / cos_lat) * rad2deg;
+  return {x - delta_lon - padding, y_min, x + delta_lon + padding, y_max};
+}
+
+}  // namespace Gahm::Datatypes
@@ -0,0 +1,132 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_DATATYPES_POINTINDEX_H_
+#define GAHM_SRC_DATATYPES_POINTINDEX_H_
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "datatypes/Point.h"
+
+#ifdef SWIG
+#define NODISCARD
+#else
+#define NODISCARD [[nodiscard]]
+#endif
+
+namespace Gahm::Datatypes {
+
+/**
+ * @brief Spatial bucket index over a set of points
+ *
+ * The points are binned into a regular longitude/latitude grid and stored in
+ * compressed row form: the indices and coordinates of the points in each
+ * bucket are contiguous and the bucket offsets are kept in a separate array.
+ * Queries return the indices of the points in the original point vector,
+ * ordered by bucket and then by index within each bucket.
+ *
+ * queryBoundingBox treats longitudes as plain numbers, so a box does not wrap
+ * across the antimeridian. The radius queries wrap: the box around the
+ * location is also searched shifted by 360 degrees each way, so a location
+ * near the antimeridian finds points on the other side of it, and the points
+ * and the location may use either the -180 to 180 or the 0 to 360 longitude
+ * convention.
+ */
+class PointIndex {
+ public:
+  explicit PointIndex(const std::vector<Gahm::Datatypes::Point> &points,
+                      double bucket_size = 0.0);
+
+  NODISCARD auto size() const -> size_t { return m_bucket_points.size(); }
+
+  NODISCARD auto bucketSize() const -> double { return m_bucket_size; }
+
+  NODISCARD auto bucketCount() const -> size_t { return m_nx * m_ny; }
+
+  NODISCARD auto queryBoundingBox(double x_min, double y_min, double x_max,
+                                  double y_max) const -> std::vector<size_t>;
+
+  NODISCARD auto queryRadius(double x, double y, double radius) const
+      -> std::vector<size_t>;
+
+#ifndef SWIG
+  void queryBoundingBox(double x_min, double y_min, double x_max, double y_max,
+                        std::vector<size_t> &result) const;
+
+  void queryRadius(double x, double y, double radius,
+                   std::vector<size_t> &result) const;
+
+  void queryRadiusBoundingBox(double x, double y, double radius,
+                              std::vector<size_t> &result) const;
+#endif
+
+  NODISCARD static auto radiusBoundingBox(double x, double y, double radius)
+      -> std::tuple<double, double, double, double>;
+
+ private:
+  NODISCARD auto bucketX(double x) const -> size_t;
+  NODISCARD auto bucketY(double y) const -> size_t;
+
+  template <typename Function>
+  void forEachInBoundingBox(double x_min, double y_min, double x_max,
+                            double y_max, const Function &function) const {
+    if (this->size() == 0 || x_max < x_min || y_max < y_min) return;
+    if (x_max < m_x_min || x_min > m_x_max || y_max < m_y_min ||
+        y_min > m_y_max) {
+      return;
+    }
+    const size_t bx0 = this->bucketX(x_min);
+    const size_t bx1 = this->bucketX(x_max);
+    const size_t by0 = this->bucketY(y_min);
+    const size_t by1 = this->bucketY(y_max);
+    for (size_t by = by0; by <= by1; ++by) {
+      const size_t first = m_bucket_offset[by * m_nx + bx0];
+      const size_t last = m_bucket_offset[by * m_nx + bx1 + 1];
+      for (size_t k = first; k < last; ++k) {
+        if (m_bucket_x[k] >= x_min && m_bucket_x[k] <= x_max &&
+            m_bucket_y[k] >= y_min && m_bucket_y[k] <= y_max) {
+          function(k);
+        }
+      }
+    }
+  }
+
+  template <typename Function>
+  void forEachInRadiusBoundingBox(double x, double y, double radius,
+                                  const Function &function) const;
+
+  double m_bucket_size;
+  double m_x_min;
+  double m_y_min;
+  double m_x_max;
+  double m_y_max;
+  size_t m_nx;
+  size_t m_ny;
+  std::vector<size_t> m_bucket_offset;
+  std::vector<size_t> m_bucket_points;
+  std::vector<double> m_bucket_x;
+  std::vector<double> m_bucket_y;
+};
+
+}  // namespace Gahm::Datatypes
+
+#endif  // GAHM_SRC_DATATYPES_POINTINDEX_H_
@@ -21,7 +21,9 @@
 #ifndef GAHM_VORTEXSOLUTION_H
 #define GAHM_VORTEXSOLUTION_H
 
+#include <cstddef>
 #include <cstdlib>
+#include <iterator>
 #include <vector>
 
 #include "Uvp.h"
@@ -33,155 +35,217 @@
 #endif
 
 namespace Gahm::Datatypes {
+
+/**
+ * @brief Solution of the vortex at a set of points
+ *
+ * The u, v and p fields are stored as separate contiguous arrays
+ * (structure-of-arrays). The u(), v() and p() accessors return read-only
+ * references to those arrays and do not allocate. Per point access through
+ * Uvp objects is still available through operator[], at() and uvp(), which
+ * assemble the Uvp on the fly.
+ *
+ * Since there is no Uvp object stored for each point, the non-const
+ * operator[] and at() return a UvpReference instead of a Uvp&. It has the
+ * accessors and setters of Uvp and writes through to the arrays, so existing
+ * code which reads or modifies a point compiles unchanged. Code which binds
+ * the result to a Uvp& must use auto or a UvpReference instead. From Python,
+ * at() returns a copy of the point, and set() modifies a point.
+ */
 class VortexSolution {
  public:
+#ifndef SWIG
+  /**
+   * @brief Writable reference to the u, v and p of a single point
+   */
+  class UvpReference {
+   public:
+    UvpReference(double &u, double &v, double &p) : m_u(&u), m_v(&v), m_p(&p) {}
+
+    UvpReference(const UvpReference &other) = default;
+
+    //...Assignment writes the values of the other point, it does not rebind
+    // the reference
+    auto operator=(const UvpReference &other) -> UvpReference & {
+      this->set(other.u(), other.v(), other.p());
+      return *this;
+    }
+
+    auto operator=(const Gahm::Datatypes::Uvp &value) -> UvpReference & {
+      this->set(value);
+      return *this;
+    }
+
+    operator Gahm::Datatypes::Uvp() const { return {*m_u, *m_v, *m_p}; }
+
+    NODISCARD auto u() const -> double { return *m_u; }
+    NODISCARD auto v() const -> double { return *m_v; }
+    NODISCARD auto p() const -> double { return *m_p; }
+
+    void setU(double u) { *m_u = u; }
+    void setV(double v) { *m_v = v; }
+    void setP(double p) { *m_p = p; }
+
+    void set(double u, double v, double p) {
+      *m_u = u;
+      *m_v = v;
+      *m_p = p;
+    }
+
+    void set(const Gahm::Datatypes::Uvp &value) {
+      this->set(value.u(), value.v(), value.p());
+    }
+
+   private:
+    double *m_u;
+    double *m_v;
+    double *m_p;
+  };
+
+  /**
+   * @brief Read-only view of the solution as a sequence of Uvp objects
+   */
+  class UvpView {
+   public:
+    class const_iterator {
+     public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = Gahm::Datatypes::Uvp;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = Gahm::Datatypes::Uvp;
+
+      const_iterator(const VortexSolution *solution, size_t index)
+          : m_solution(solution), m_index(index) {}
+
+      auto operator*() const -> Gahm::Datatypes::Uvp {
+        return (*m_solution)[m_index];
+      }
+      auto operator++() -> const_iterator & {
+        ++m_index;
+        return *this;
+      }
+      auto operator++(int) -> const_iterator {
+        auto tmp = *this;
+        ++m_index;
+        return tmp;
+      }
+      auto operator+(difference_type n) const -> const_iterator {
+        return {m_solution, static_cast<size_t>(
+                                static_cast<difference_type>(m_index) + n)};
+      }
+      auto operator-(const const_iterator &rhs) const -> difference_type {
+        return static_cast<difference_type>(m_index) -
+               static_cast<difference_type>(rhs.m_index);
+      }
+      auto operator==(const const_iterator &rhs) const -> bool {
+        return m_index == rhs.m_index && m_solution == rhs.m_solution;
+      }
+      auto operator!=(const const_iterator &rhs) const -> bool {
+        return !(*this == rhs);
+      }
+
+     private:
+      const VortexSolution *m_solution;
+      size_t m_index;
+    };
+
+    explicit UvpView(const VortexSolution *solution) : m_solution(solution) {}
+
+    NODISCARD auto size() const -> size_t { return m_solution->size(); }
+    NODISCARD auto empty() const -> bool { return m_solution->empty(); }
+    auto operator[](size_t index) const -> Gahm::Datatypes::Uvp {
+      return (*m_solution)[index];
+    }
+    NODISCARD auto begin() const -> const_iterator { return {m_solution, 0}; }
+    NODISCARD auto end() const -> const_iterator {
+      return {m_solution, m_solution->size()};
+    }
+
+   private:
+    const VortexSolution *m_solution;
+  };
+#endif
+
   VortexSolution() = default;
 
-  explicit VortexSolution(size_t size) { m_uvp.reserve(size); }
+  explicit VortexSolution(size_t size) { this->reserve(size); }
 
-  NODISCARD auto size() const -> size_t { return m_uvp.size(); }
+  NODISCARD auto size() const -> size_t { return m_u.size(); }
 
-  NODISCARD auto empty() const -> bool { return m_uvp.empty(); }
+  NODISCARD auto empty() const -> bool { return m_u.empty(); }
 
   void resize(size_t size, const Gahm::Datatypes::Uvp &value) {
-    m_uvp.resize(size, value);
+    m_u.resize(size, value.u());
+    m_v.resize(size, value.v());
+    m_p.resize(size, value.p());
   }
 
-  void reserve(size_t size) { m_uvp.reserve(size); }
+  void reserve(size_t size) {
+    m_u.reserve(size);
+    m_v.reserve(size);
+    m_p.reserve(size);
+  }
 
 #ifndef SWIG
-  auto operator[](size_t index) -> Gahm::Datatypes::Uvp & {
-    return m_uvp[index];
+  auto operator[](size_t index) -> UvpReference {
+    return {m_u[index], m_v[index], m_p[index]};
   }
-  NODISCARD auto operator[](size_t index) const
-      -> const Gahm::Datatypes::Uvp & {
-    return m_uvp[index];
-  }
-#endif
 
-  Gahm::Datatypes::Uvp &at(size_t index) { return this->operator[](index); }
+  NODISCARD auto operator[](size_t index) const -> Gahm::Datatypes::Uvp {
+    return {m_u[index], m_v[index], m_p[index]};
+  }
 
-  NODISCARD const Gahm::Datatypes::Uvp &at(size_t index) const {
-    return this->operator[](index);
+  auto at(size_t index) -> UvpReference {
+    return {m_u.at(index), m_v.at(index), m_p.at(index)};
   }
+#endif
 
-  NODISCARD const std::vector<Gahm::Datatypes::Uvp> &uvp() const {
-    return m_uvp;
+  NODISCARD auto at(size_t index) const -> Gahm::Datatypes::Uvp {
+    return {m_u.at(index), m_v.at(index), m_p.at(index)};
   }
 
-  void push_back(const Gahm::Datatypes::Uvp &value) { m_uvp.push_back(value); }
+  void set(size_t index, double u, double v, double p) {
+    m_u[index] = u;
+    m_v[index] = v;
+    m_p[index] = p;
+  }
 
-  template <class... Args>
-  void emplace_back(Args &&...args) {
-    m_uvp.emplace_back(std::forward<Args>(args)...);
+  void set(size_t index, const Gahm::Datatypes::Uvp &value) {
+    this->set(index, value.u(), value.v(), value.p());
   }
 
 #ifndef SWIG
-  auto front() { return m_uvp.front(); }
-  auto back() { return m_uvp.back(); }
+  NODISCARD auto uvp() const -> UvpView { return UvpView(this); }
 #endif
 
-  NODISCARD auto u() const -> std::vector<double> {
-    std::vector<double> u;
-    u.reserve(m_uvp.size());
-    for (const auto &i : m_uvp) {
-      u.push_back(i.u());
-    }
-    return u;
+  void push_back(const Gahm::Datatypes::Uvp &value) {
+    this->emplace_back(value.u(), value.v(), value.p());
   }
 
-  NODISCARD auto v() const -> std::vector<double> {
-    std::vector<double> v;
-    v.reserve(m_uvp.size());
-    for (const auto &i : m_uvp) {
-      v.push_back(i.v());
-    }
-    return v;
+  void emplace_back(double u, double v, double p) {
+    m_u.push_back(u);
+    m_v.push_back(v);
+    m_p.push_back(p);
   }
 
-  NODISCARD auto p() const -> std::vector<double> {
-    std::vector<double> p;
-    p.reserve(m_uvp.size());
-    for (const auto &i : m_uvp) {
-      p.push_back(i.p());
-    }
-    return p;
+#ifndef SWIG
+  NODISCARD auto front() const -> Gahm::Datatypes::Uvp { return (*this)[0]; }
+  NODISCARD auto back() const -> Gahm::Datatypes::Uvp {
+    return (*this)[this->size() - 1];
   }
+#endif
 
-//  NODISCARD auto azimuth() const -> std::vector<double> {
-//    std::vector<double> azimuth;
-//    azimuth.reserve(m_uvp.size());
-//    for (const auto &i : m_uvp) {
-//      azimuth.push_back(i.azimuth());
-//    }
-//    return azimuth;
-//  }
-//
-//  NODISCARD auto distance() const -> std::vector<double> {
-//    std::vector<double> distance;
-//    distance.reserve(m_uvp.size());
-//    for (const auto &i : m_uvp) {
-//      distance.push_back(i.distance());
-//    }
-//    return distance;
-//  }
-//
-//  NODISCARD auto tsx() const -> std::vector<double> {
-//    std::vector<double> tsx;
-//    tsx.reserve(m_uvp.size());
-//    for (const auto &i : m_uvp) {
-//      tsx.push_back(i.tsx());
-//    }
-//    return tsx;
-//  }
-//
-//  NODISCARD auto tsy() const -> std::vector<double> {
-//    std::vector<double> tsy;
-//    tsy.reserve(m_uvp.size());
-//    for (const auto &i : m_uvp) {
-//      tsy.push_back(i.tsy());
-//    }
-//    return tsy;
-//  }
-//
-//  NODISCARD auto quadrant_weight() const -> std::vector<double> {
-//    std::vector<double> quadrant_weight;
-//    quadrant_weight.reserve(m_uvp.size());
-//    for (const auto &i : m_uvp) {
-//      quadrant_weight.push_back(i.quadrant_weight());
-//    }
-//    return quadrant_weight;
-//  }
-//
-//  NODISCARD auto isotach_weight() const -> std::vector<double> {
-//    std::vector<double> isotach_weight;
-//    isotach_weight.reserve(m_uvp.size());
-//    for (const auto &i : m_uvp) {
-//      isotach_weight.push_back(i.isotach_weight());
-//    }
-//    return isotach_weight;
-//  }
-//
-//  NODISCARD auto quadrant() const -> std::vector<double> {
-//    std::vector<double> quadrant;
-//    quadrant.reserve(m_uvp.size());
-//    for (const auto &iter : m_uvp) {
-//      quadrant.push_back(iter.quadrant());
-//    }
-//    return quadrant;
-//  }
-//
-//  NODISCARD auto isotach() const -> std::vector<double> {
-//    std::vector<double> isotach;
-//    isotach.reserve(m_uvp.size());
-//    for (const auto &iter : m_uvp) {
-//      isotach.push_back(iter.isotach());
-//    }
-//    return isotach;
-//  }
+  NODISCARD auto u() const -> const std::vector<double> & { return m_u; }
+
+  NODISCARD auto v() const -> const std::vector<double> & { return m_v; }
+
+  NODISCARD auto p() const -> const std::vector<double> & { return m_p; }
 
  private:
-  std::vector<Gahm::Datatypes::Uvp> m_uvp;
+  std::vector<double> m_u;
+  std::vector<double> m_v;
+  std::vector<double> m_p;
 };
 }  // namespace Gahm::Datatypes
 
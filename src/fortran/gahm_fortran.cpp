@@ -18,11 +18,14 @@
 // Author: Zach Cobell
 // Contact: zcobell@thewaterinstitute.org
 //
-#include <cassert>
+#include <exception>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <utility>
 
+#include "atcf/AtcfCache.h"
 #include "atcf/AtcfFile.h"
 #include "datatypes/PointCloud.h"
 #include "preprocessor/Preprocessor.h"
@@ -43,11 +46,33 @@
 class gahm_instance {
  public:
   gahm_instance(const std::string &filename,
-                const Gahm::Datatypes::PointCloud &point_cloud, bool quiet) {
-    this->m_atcf = std::make_unique<Gahm::Atcf::AtcfFile>(filename, quiet);
-    this->m_atcf->read();
-    this->m_preprocessor = std::make_unique<Gahm::Preprocessor>(m_atcf.get());
-    this->m_preprocessor->solve();
+                const Gahm::Datatypes::PointCloud &point_cloud, bool quiet,
+                const std::string &cache_filename = std::string()) {
+    //...A valid cache replaces reading and preprocessing the ATCF file. When
+    // the cache is missing or out of date it is rebuilt after preprocessing
+    if (!cache_filename.empty()) {
+      auto cached = Gahm::Atcf::AtcfCache::read(cache_filename, filename);
+      if (cached.has_value()) {
+        this->m_atcf =
+            std::make_unique<Gahm::Atcf::AtcfFile>(std::move(*cached));
+      }
+    }
+
+    if (this->m_atcf == nullptr) {
+      this->m_atcf = std::make_unique<Gahm::Atcf::AtcfFile>(filename, quiet);
+      this->m_atcf->read();
+      this->m_preprocessor =
+          std::make_unique<Gahm::Preprocessor>(m_atcf.get());
+      this->m_preprocessor->solve();
+      if (!cache_filename.empty()) {
+        try {
+          Gahm::Atcf::AtcfCache::write(*m_atcf, cache_filename);
+        } catch (const std::exception &e) {
+          std::cerr << "[GAHM Library WARNING]: " << e.what() << std::endl;
+        }
+      }
+    }
+
     this->m_vortex = std::make_unique<Gahm::Vortex>(m_atcf.get(), point_cloud);
   }
 
@@ -71,6 +96,8 @@ static std::vector<std::unique_ptr<gahm_instance>> g_gahm_instances;
 extern "C" {
 long gahm_create_ftn(char *filename, long size, double *x, double *y,
                      bool quiet);
+long gahm_create_cached_ftn(char *filename, char *cache_filename, long size,
+                            double *x, double *y, bool quiet);
 void gahm_destroy_ftn(long id);
 void gahm_get_ftn(long id, int year, int month, int day, int hour, int minute,
                   int second, long size, double *u, double *v, double *p);
@@ -80,22 +107,32 @@ void gahm_date_add_ftn(int year_in, int month_in, int day_in, int hour_in,
                        int minute_in, int second_in, int add_seconds,
                        int &year_out, int &month_out, int &day_out,
                        int &hour_out, int &minute_out, int &second_out);
+void gahm_set_forcing_interval_ftn(long id, int interval, bool storm_frame);
+void gahm_set_polar_grid_ftn(long id, long azimuth_count, long radius_count,
+                             double inner_radius, double outer_radius);
 }
 
 long gahm_create_ftn(char *filename, long size, double *x, double *y,
                      bool quiet) {
+  return gahm_create_cached_ftn(filename, nullptr, size, x, y, quiet);
+}
+
+long gahm_create_cached_ftn(char *filename, char *cache_filename, long size,
+                            double *x, double *y, bool quiet) {
   std::string filename_str(filename);
+  std::string cache_filename_str =
+      cache_filename == nullptr ? std::string() : std::string(cache_filename);
   std::vector<double> x_pos(x, x + size);
   std::vector<double> y_pos(y, y + size);
 
   auto point_cloud = Gahm::Datatypes::PointCloud(x_pos, y_pos);
 #if GAHM_FORTRAN_USE_MAP_LOOKUP == 1
-  g_gahm_instances[g_counter] =
-      std::make_unique<gahm_instance>(filename_str, point_cloud, quiet);
+  g_gahm_instances[g_counter] = std::make_unique<gahm_instance>(
+      filename_str, point_cloud, quiet, cache_filename_str);
   return g_counter;
 #else
-  g_gahm_instances.push_back(
-      std::make_unique<gahm_instance>(filename_str, point_cloud, quiet));
+  g_gahm_instances.push_back(std::make_unique<gahm_instance>(
+      filename_str, point_cloud, quiet, cache_filename_str));
   return g_gahm_instances.size() - 1;
 #endif
 }
@@ -118,15 +155,17 @@ void gahm_get_ftn(long id, int year, int month, int day, int hour, int minute,
     return;
   }
 
-  auto d = Gahm::Datatypes::Date(year, month, day, hour, minute, second);
-  auto sln = instance->vortex()->solve(d);
-
-  assert(sln.size() == size);
-  for (size_t i = 0; i < size; ++i) {
-    u[i] = sln.u()[i];
-    v[i] = sln.v()[i];
-    p[i] = sln.p()[i];
+  //...Check that the Fortran arrays match the size of the point cloud
+  if (size != static_cast<long>(instance->vortex()->points().size())) {
+    std::cerr << "[GAHM Library ERROR]: The size of the output arrays does "
+                 "not match the number of points in the vortex object."
+              << std::endl;
+    return;
   }
+
+  //...Solve directly into the Fortran arrays
+  auto d = Gahm::Datatypes::Date(year, month, day, hour, minute, second);
+  instance->vortex()->solveInto(d, u, v, p, static_cast<size_t>(size));
 }
 
 long gahm_get_serial_date_ftn(int year, int month, int day, int hour,
@@ -149,3 +188,38 @@ void gahm_date_add_ftn(int year_in, int month_in, int day_in, int hour_in,
   minute_out = d.minute();
   second_out = d.second();
 }
+
+void gahm_set_forcing_interval_ftn(long id, int interval, bool storm_frame) {
+  auto instance = g_gahm_instances[id].get();
+  if (instance == nullptr) {
+    std::cerr << "[GAHM Library ERROR]: The requested vortex object is null."
+              << std::endl;
+    return;
+  }
+
+  try {
+    instance->vortex()->setForcingInterval(
+        interval, storm_frame ? Gahm::Vortex::STORM_FRAME
+                              : Gahm::Vortex::MESH_FRAME);
+  } catch (const std::exception &e) {
+    std::cerr << "[GAHM Library ERROR]: " << e.what() << std::endl;
+  }
+}
+
+void gahm_set_polar_grid_ftn(long id, long azimuth_count, long radius_count,
+                             double inner_radius, double outer_radius) {
+  auto instance = g_gahm_instances[id].get();
+  if (instance == nullptr) {
+    std::cerr << "[GAHM Library ERROR]: The requested vortex object is null."
+              << std::endl;
+    return;
+  }
+
+  try {
+    instance->vortex()->setPolarGrid(static_cast<size_t>(azimuth_count),
+                                     static_cast<size_t>(radius_count),
+                                     inner_radius, outer_radius);
+  } catch (const std::exception &e) {
+    std::cerr << "[GAHM Library ERROR]: " << e.what() << std::endl;
+  }
+}
@@ -7,19 +7,24 @@
 
 #include <string>
 
+#include "atcf/AtcfCache.h"
 #include "atcf/AtcfFile.h"
 #include "atcf/AtcfIsotach.h"
 #include "atcf/AtcfQuadrant.h"
 #include "atcf/AtcfSnap.h"
+#include "atcf/CompiledTrack.h"
 #include "atcf/StormPosition.h"
 #include "atcf/StormTranslation.h"
+#include "atcf/TimeIndex.h"
 #include "datatypes/Date.h"
 #include "datatypes/Point.h"
 #include "datatypes/PointCloud.h"
+#include "datatypes/PointIndex.h"
 #include "datatypes/PointPosition.h"
 #include "datatypes/Uvp.h"
 #include "datatypes/VortexSolution.h"
 #include "datatypes/WindGrid.h"
+#include "gahm/GahmBatchSolver.h"
 #include "gahm/GahmEquations.h"
 #include "gahm/GahmSolver.h"
 #include "output/OutputFile.h"
@@ -29,6 +34,8 @@
 #include "physical/Earth.h"
 #include "physical/Units.h"
 #include "preprocessor/Preprocessor.h"
+#include "preprocessor/SolutionCache.h"
+#include "vortex/PolarGrid.h"
 #include "vortex/Vortex.h"
 
 namespace Gahm {
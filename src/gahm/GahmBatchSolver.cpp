@@ -0,0 +1,366 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "GahmBatchSolver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "boost/math/policies/error_handling.hpp"
+#include "gahm/GahmEquations.h"
+#include "gahm/GahmRadiusSolver.h"
+#include "gahm/GahmSolver.h"
+#include "physical/Atmospheric.h"
+#include "physical/Earth.h"
+#include "util/VectorMath.h"
+
+namespace Gahm::Solver {
+
+//...Bits in m_bracket recording the sides of the root which have been seen
+constexpr uint8_t c_seen_negative = 1;
+constexpr uint8_t c_seen_positive = 2;
+
+/**
+ * Construct a batch GAHM solver for the quadrants of one snap
+ * @param p_center Minimum pressure for the storm
+ * @param p_background Background atmospheric pressure
+ * @param latitude latitude of storm center
+ */
+GahmBatchSolver::GahmBatchSolver(double p_center, double p_background,
+                                 double latitude)
+    : m_pc(p_center),
+      m_pbk(p_background),
+      m_latitude(latitude),
+      m_fc(Gahm::Physical::Earth::coriolis(latitude)),
+      m_tolerance(GahmRadiusSolver::c_default_tolerance) {}
+
+/**
+ * Adds a quadrant to the batch
+ * @param isotach_radius Radius of the isotach
+ * @param isotach_speed Speed of the isotach
+ * @param vmax Maximum wind speed
+ * @return Lane index of the quadrant
+ */
+auto GahmBatchSolver::addQuadrant(double isotach_radius, double isotach_speed,
+                                  double vmax) -> size_t {
+  m_isotach_radius.push_back(isotach_radius);
+  m_isotach_speed.push_back(isotach_speed);
+  m_vmax.push_back(vmax);
+  return m_vmax.size() - 1;
+}
+
+/**
+ * Sets the convergence tolerance of the radius to maximum winds in each
+ * Newton solve
+ * @param tolerance tolerance in meters
+ */
+void GahmBatchSolver::setRadiusTolerance(double tolerance) {
+  m_tolerance = tolerance;
+}
+
+/**
+ * Runs the solver for every lane. A lane which fails does not stop the others
+ * and its message is available from error()
+ */
+void GahmBatchSolver::solve() {
+  const size_t n = this->size();
+  m_rmax.assign(n, std::numeric_limits<double>::max());
+  m_bg.resize(n);
+  m_solver_bg.resize(n);
+  m_it.assign(n, 0);
+  m_newton_it.assign(n, 0);
+  m_state.assign(n, Active);
+  m_error.assign(n, std::string());
+  m_x.resize(n);
+  m_f.resize(n);
+  m_f_prime.resize(n);
+  m_x_negative.resize(n);
+  m_x_positive.resize(n);
+  m_bracket.resize(n);
+  m_searching.resize(n);
+
+  std::vector<double> guess(n);
+  for (size_t k = 0; k < n; ++k) {
+    m_bg[k] = Gahm::Physical::Atmospheric::calcHollandB(m_vmax[k], m_pc, m_pbk);
+    m_solver_bg[k] = m_bg[k];
+    guess[k] = GahmSolver::estimateRmax(m_pbk - m_pc, m_latitude,
+                                        m_isotach_radius[k]);
+  }
+
+  for (size_t i = 0; i < GahmSolver::c_max_iterations; ++i) {
+    if (std::none_of(m_state.begin(), m_state.end(),
+                     [](const auto state) { return state == Active; })) {
+      break;
+    }
+
+    this->solveRadius(guess);
+
+    for (size_t k = 0; k < n; ++k) {
+      if (m_state[k] != Active) continue;
+      m_rmax[k] = m_x[k];
+      const auto phi =
+          GahmEquations::phi(m_vmax[k], m_rmax[k], m_bg[k], m_fc);
+      m_bg[k] = GahmEquations::gahm_b(m_vmax[k], m_rmax[k], m_pc, m_pbk,
+                                      m_fc, phi);
+      if (std::abs(m_bg[k] - m_solver_bg[k]) <
+          GahmSolver::c_gahm_b_tolerance) {
+        m_it[k] = i + 1;
+        m_state[k] = Converged;
+      } else if (!std::isfinite(m_bg[k]) || !std::isfinite(phi)) {
+        m_state[k] = Failed;
+        m_error[k] = "Solution did not converge.";
+      } else {
+        m_solver_bg[k] = m_bg[k];
+      }
+    }
+  }
+
+  for (size_t k = 0; k < n; ++k) {
+    if (m_state[k] == Active) {
+      m_state[k] = Failed;
+      m_error[k] = "Solution did not converge.";
+    }
+  }
+}
+
+/**
+ * Solves for the radius to maximum winds of each active lane with the current
+ * GAHM Holland B. This is the same safeguarded Newton iteration as
+ * GahmRadiusSolver::solve, run in lockstep. The solution is left in m_x and a
+ * lane which fails is marked as failed
+ * @param guess Initial guess for each lane
+ */
+void GahmBatchSolver::solveRadius(const std::vector<double> &guess) {
+  const size_t n = this->size();
+  constexpr double lower = 1.0;
+
+  size_t n_searching = 0;
+  for (size_t k = 0; k < n; ++k) {
+    m_searching[k] = m_state[k] == Active ? 1 : 0;
+    m_bracket[k] = 0;
+    m_x[k] = std::clamp(guess[k], lower, m_isotach_radius[k]);
+    n_searching += m_searching[k];
+  }
+
+  for (size_t iteration = 0;
+       iteration < GahmRadiusSolver::c_max_iterations && n_searching > 0;
+       ++iteration) {
+    GahmBatchSolver::evaluate(n, m_x.data(), m_isotach_radius.data(),
+                              m_isotach_speed.data(), m_vmax.data(),
+                              m_solver_bg.data(), m_fc, m_f.data(),
+                              m_f_prime.data());
+
+    n_searching = 0;
+    for (size_t k = 0; k < n; ++k) {
+      if (!m_searching[k]) continue;
+      m_newton_it[k]++;
+
+      const double x = m_x[k];
+      const double f = m_f[k];
+      const double df = m_f_prime[k];
+      const double upper = m_isotach_radius[k];
+
+      if (!std::isfinite(f) || !std::isfinite(df)) {
+        m_searching[k] = 0;
+        m_state[k] = Failed;
+        m_error[k] =
+            "Unable to solve for radius to maximum winds: Function is not "
+            "finite at " +
+            std::to_string(x);
+        continue;
+      }
+      if (f == 0.0) {
+        m_searching[k] = 0;
+        continue;
+      }
+
+      if (f < 0.0) {
+        m_x_negative[k] = x;
+        m_bracket[k] |= c_seen_negative;
+      } else {
+        m_x_positive[k] = x;
+        m_bracket[k] |= c_seen_positive;
+      }
+
+      double x_new = x - f / df;
+      if (m_bracket[k] == (c_seen_negative | c_seen_positive)) {
+        const auto [lo, hi] = std::minmax(m_x_negative[k], m_x_positive[k]);
+        if (!(x_new > lo && x_new < hi)) x_new = 0.5 * (lo + hi);
+      } else if (!(x_new >= lower && x_new <= upper)) {
+        const double bound = x_new < lower ? lower : upper;
+        if (std::abs(x - bound) < m_tolerance) {
+          m_searching[k] = 0;
+          m_state[k] = Failed;
+          m_error[k] =
+              "Unable to solve for radius to maximum winds: No root between " +
+              std::to_string(lower) + " and " + std::to_string(upper);
+          continue;
+        }
+        m_x[k] = 0.5 * (x + bound);
+        n_searching++;
+        continue;
+      }
+
+      m_x[k] = x_new;
+      if (std::abs(x_new - x) < m_tolerance) {
+        m_searching[k] = 0;
+      } else {
+        n_searching++;
+      }
+    }
+  }
+
+  for (size_t k = 0; k < n; ++k) {
+    if (m_searching[k]) {
+      m_state[k] = Failed;
+      m_error[k] =
+          "Unable to solve for radius to maximum winds: No convergence after " +
+          std::to_string(GahmRadiusSolver::c_max_iterations) + " iterations";
+    }
+  }
+}
+
+/**
+ * Evaluates the gradient wind function and its first derivative for every
+ * lane. This is GahmEquations::GahmFunctionAndDerivatives without the second
+ * derivative, written as a single loop so that it is vectorized. Lanes which
+ * are no longer active are evaluated too, which is cheaper than masking them
+ * @param n Number of lanes
+ * @param rmax Radius to max winds of each lane
+ * @param isotach_radius Isotach radius of each lane
+ * @param isotach_speed Isotach speed of each lane
+ * @param vmax Maximum wind speed of each lane
+ * @param gahm_b GAHM Holland B of each lane
+ * @param f_coriolis Coriolis force
+ * @param f Gradient wind function of each lane
+ * @param f_prime Derivative of the gradient wind function of each lane
+ */
+GAHM_TARGET_CLONES
+void GahmBatchSolver::evaluate(const size_t n, const double *rmax,
+                               const double *isotach_radius,
+                               const double *isotach_speed, const double *vmax,
+                               const double *gahm_b, const double f_coriolis,
+                               double *f, double *f_prime) {
+  const double sign_of_coriolis = f_coriolis >= 0.0 ? 1.0 : -1.0;
+#pragma omp simd
+  for (size_t k = 0; k < n; ++k) {
+    const double rm = rmax[k];
+    const double vm = vmax[k];
+    const double bg = gahm_b[k];
+
+    const double g = 1.0 + (f_coriolis * rm) / vm;
+    const double dg_over_g = (f_coriolis / vm) / g;
+
+    const double rossby = vm / (f_coriolis * rm);
+    const double phi = 1.0 + (1.0 / (rossby * bg * (1.0 + 1.0 / rossby)));
+    const double vm_plus_frm = vm + f_coriolis * rm;
+    const double dphi = (f_coriolis * vm) / (bg * vm_plus_frm * vm_plus_frm);
+
+    const double rmbg = VectorMath::pow(rm / isotach_radius[k], bg);
+    const double drmbg = bg * rmbg / rm;
+
+    const double beta = phi * (1.0 - rmbg);
+    const double dbeta = dphi * (1.0 - rmbg) - phi * drmbg;
+
+    const double p = g * VectorMath::exp(beta) * rmbg;
+    const double dp = p * (dg_over_g + dbeta + bg / rm);
+
+    const double vm2 = vm * vm;
+    const double half_fr = (isotach_radius[k] * f_coriolis) / 2.0;
+    const double sqrt_s = std::sqrt(vm2 * p + half_fr * half_fr);
+
+    f[k] = sign_of_coriolis * sqrt_s - half_fr - isotach_speed[k];
+    f_prime[k] = sign_of_coriolis * vm2 * dp / (2.0 * sqrt_s);
+  }
+}
+
+/**
+ * Returns the number of quadrants in the batch
+ * @return number of lanes
+ */
+auto GahmBatchSolver::size() const -> size_t { return m_vmax.size(); }
+
+/**
+ * Returns the radius to maximum winds of a lane
+ * @param lane Lane index
+ * @return radius to maximum winds
+ */
+auto GahmBatchSolver::rmax(size_t lane) const -> double {
+  if (!this->converged(lane)) {
+    throw boost::math::evaluation_error(
+        "GAHM Solver ERROR: Solver has not converged");
+  }
+  return m_rmax[lane];
+}
+
+/**
+ * Returns the GAHM Holland B of a lane
+ * @param lane Lane index
+ * @return GAHM Holland B
+ */
+auto GahmBatchSolver::gahm_b(size_t lane) const -> double {
+  if (!this->converged(lane)) {
+    throw boost::math::evaluation_error(
+        "GAHM Solver ERROR: Solver has not converged");
+  }
+  return m_bg[lane];
+}
+
+/**
+ * Returns the number of outer iterations used by a lane. This is zero until
+ * the lane has converged
+ * @param lane Lane index
+ * @return number of outer iterations
+ */
+auto GahmBatchSolver::it(size_t lane) const -> size_t { return m_it[lane]; }
+
+/**
+ * Returns the total number of Newton iterations used by a lane
+ * @param lane Lane index
+ * @return number of Newton iterations
+ */
+auto GahmBatchSolver::newtonIterations(size_t lane) const -> size_t {
+  return m_newton_it[lane];
+}
+
+/**
+ * Returns true if the lane has converged
+ * @param lane Lane index
+ * @return convergence status
+ */
+auto GahmBatchSolver::converged(size_t lane) const -> bool {
+  return lane < m_state.size() && m_state[lane] == Converged;
+}
+
+/**
+ * Returns the error message for a lane which failed to solve, or an empty
+ * string
+ * @param lane Lane index
+ * @return error message
+ */
+auto GahmBatchSolver::error(size_t lane) const -> const std::string & {
+  return m_error[lane];
+}
+}  // namespace Gahm::Solver
@@ -0,0 +1,109 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_GAHMBATCHSOLVER_H_
+#define GAHM_SRC_GAHMBATCHSOLVER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Gahm::Solver {
+
+/**
+ * @brief Solves several quadrants of a snap together
+ *
+ * The quadrants share the central pressure, background pressure and latitude
+ * of the snap. Each quadrant is a lane which goes through the same steps as
+ * GahmSolver. The lanes run in lockstep so that evaluating the gradient wind
+ * function for all lanes is a single vectorized loop. A lane which has
+ * converged or failed is masked out of the updates until the last lane is
+ * done.
+ *
+ * The function is evaluated with the routines in util/VectorMath.h, so a lane
+ * can take a slightly different path than GahmSolver. It converges to the same
+ * root within the tolerance of the radius solver.
+ */
+class GahmBatchSolver {
+ public:
+  GahmBatchSolver(double p_center, double p_background, double latitude);
+
+  auto addQuadrant(double isotach_radius, double isotach_speed, double vmax)
+      -> size_t;
+
+  void setRadiusTolerance(double tolerance);
+
+  void solve();
+
+  [[nodiscard]] auto size() const -> size_t;
+
+  [[nodiscard]] auto rmax(size_t lane) const -> double;
+
+  [[nodiscard]] auto gahm_b(size_t lane) const -> double;
+
+  [[nodiscard]] auto it(size_t lane) const -> size_t;
+
+  [[nodiscard]] auto newtonIterations(size_t lane) const -> size_t;
+
+  [[nodiscard]] auto converged(size_t lane) const -> bool;
+
+  [[nodiscard]] auto error(size_t lane) const -> const std::string &;
+
+ private:
+  enum t_lane_state : uint8_t { Active, Converged, Failed };
+
+  void solveRadius(const std::vector<double> &guess);
+
+  static void evaluate(size_t n, const double *rmax,
+                       const double *isotach_radius,
+                       const double *isotach_speed, const double *vmax,
+                       const double *gahm_b, double f_coriolis, double *f,
+                       double *f_prime);
+
+  double m_pc;
+  double m_pbk;
+  double m_latitude;
+  double m_fc;
+  double m_tolerance;
+
+  std::vector<double> m_isotach_radius;
+  std::vector<double> m_isotach_speed;
+  std::vector<double> m_vmax;
+  std::vector<double> m_rmax;
+  std::vector<double> m_bg;
+  std::vector<double> m_solver_bg;
+  std::vector<size_t> m_it;
+  std::vector<size_t> m_newton_it;
+  std::vector<t_lane_state> m_state;
+  std::vector<std::string> m_error;
+
+  //...Scratch storage for the Newton iteration
+  std::vector<double> m_x;
+  std::vector<double> m_f;
+  std::vector<double> m_f_prime;
+  std::vector<double> m_x_negative;
+  std::vector<double> m_x_positive;
+  std::vector<uint8_t> m_bracket;
+  std::vector<uint8_t> m_searching;
+};
+}  // namespace Gahm::Solver
+
+#endif  // GAHM_SRC_GAHMBATCHSOLVER_H_
@@ -21,6 +21,7 @@
 #include "GahmEquations.h"
 
 #include <cmath>
+#include <tuple>
 
 #include "physical/Atmospheric.h"
 
@@ -144,6 +145,78 @@ auto Gahm::Solver::GahmEquations::GahmFunctionDerivative(
                                 phi);
 }
 
+/**
+ * Computes \f$V_g(r_m)\f$ and its first and second derivatives with respect to
+ * the radius to max winds in a single pass, for use by the radius solver.
+ * Unlike GahmFunctionDerivative, the derivatives include the dependence of
+ * \f$\phi\f$ on \f$r_m\f$, so the Newton iteration converges quadratically.
+ *
+ * Writing \f$V_g = \sqrt{S} - \frac{fr}{2}\f$ with
+ * \f$S = {v_m}^2 P + \frac{f^2r^2}{4}\f$ and
+ * \f$P = \left(\gamma+1\right)e^\beta\alpha^{b_g}\f$, the derivatives
+ * follow from the logarithmic derivative of \f$P\f$, so \f$\alpha^{b_g}\f$,
+ * \f$e^\beta\f$ and \f$\sqrt{S}\f$ are each only computed once
+ *
+ * @param radius_to_max_wind radius to max winds
+ * @param vmax_at_boundary_layer maximum wind speed
+ * @param isotach_windspeed_at_boundary_layer speed of the current isotach
+ * @param distance radius of the current isotach
+ * @param coriolis_force coriolis force
+ * @param gahm_holland_b GAHM Holland B
+ * @return Tuple of \f$V_g\f$, \f$V_g^{\prime}\f$ and \f$V_g^{\prime\prime}\f$
+ */
+auto Gahm::Solver::GahmEquations::GahmFunctionAndDerivatives(
+    double radius_to_max_wind, double vmax_at_boundary_layer,
+    double isotach_windspeed_at_boundary_layer, double distance,
+    double coriolis_force, double gahm_holland_b)
+    -> std::tuple<double, double, double> {
+  const auto rm = radius_to_max_wind;
+  const auto vm = vmax_at_boundary_layer;
+  const auto bg = gahm_holland_b;
+
+  //...gamma + 1 and its derivative
+  const auto g = 1.0 + (coriolis_force * rm) / vm;
+  const auto dg_over_g = (coriolis_force / vm) / g;
+
+  //...phi = 1 + f rm / (b_g (vm + f rm)) and its derivatives
+  const auto phi = GahmEquations::phi(vm, rm, bg, coriolis_force);
+  const auto vm_plus_frm = vm + coriolis_force * rm;
+  const auto dphi = (coriolis_force * vm) / (bg * vm_plus_frm * vm_plus_frm);
+  const auto d2phi = -2.0 * dphi * coriolis_force / vm_plus_frm;
+
+  //...alpha^b_g and its derivatives
+  const auto rmbg = std::pow(rm / distance, bg);
+  const auto drmbg = bg * rmbg / rm;
+  const auto d2rmbg = (bg - 1.0) * drmbg / rm;
+
+  //...beta = phi * (1 - alpha^b_g) and its derivatives
+  const auto beta = phi * (1.0 - rmbg);
+  const auto dbeta = dphi * (1.0 - rmbg) - phi * drmbg;
+  const auto d2beta =
+      d2phi * (1.0 - rmbg) - 2.0 * dphi * drmbg - phi * d2rmbg;
+
+  //...P and its derivatives from the logarithmic derivative L = P' / P
+  const auto p = g * std::exp(beta) * rmbg;
+  const auto l = dg_over_g + dbeta + bg / rm;
+  const auto dl = -dg_over_g * dg_over_g + d2beta - bg / (rm * rm);
+  const auto dp = p * l;
+  const auto d2p = p * (l * l + dl);
+
+  const auto vm2 = vm * vm;
+  const auto half_fr = (distance * coriolis_force) / 2.0;
+  const auto s = vm2 * p + half_fr * half_fr;
+  const auto sqrt_s = std::sqrt(s);
+  const auto sign_of_coriolis = coriolis_force >= 0.0 ? 1.0 : -1.0;
+
+  const auto vg = sign_of_coriolis * sqrt_s - half_fr -
+                  isotach_windspeed_at_boundary_layer;
+  const auto dvg = sign_of_coriolis * vm2 * dp / (2.0 * sqrt_s);
+  const auto d2vg =
+      sign_of_coriolis * (vm2 * d2p / (2.0 * sqrt_s) -
+                          (vm2 * dp) * (vm2 * dp) / (4.0 * s * sqrt_s));
+  return {vg, dvg, d2vg};
+}
+
 auto Gahm::Solver::GahmEquations::GahmPressure(
     double central_pressure, double background_pressure, double distance,
     double radius_to_max_winds, double gahm_holland_b, double phi) -> double {
@@ -159,4 +232,48 @@ auto Gahm::Solver::GahmEquations::GahmWindSpeed(
   return Gahm::Solver::GahmEquations::GahmFunction(
       radius_to_max_wind, vmax_at_boundary_layer, 0.0, distance, coriolis,
       gahm_holland_b);
-}
\ No newline at end of file
+}
+
+/**
+ * Computes the gradient wind speed and the pressure at a point in a single
+ * pass. This gives the same result as calling GahmWindSpeed and GahmPressure
+ * with phi computed from the same parameters, but phi, the Rossby number,
+ * \f$\alpha^{b_g}\f$ and \f$e^{-\phi\alpha^{b_g}}\f$ are only computed once
+ *
+ * @param radius_to_max_wind radius to max winds
+ * @param vmax_at_boundary_layer maximum wind speed
+ * @param distance distance from the storm center
+ * @param coriolis coriolis force
+ * @param gahm_holland_b GAHM Holland B
+ * @param central_pressure central pressure
+ * @param background_pressure background pressure
+ * @return Tuple of the gradient wind speed and the pressure
+ */
+auto Gahm::Solver::GahmEquations::GahmWindSpeedAndPressure(
+    double radius_to_max_wind, double vmax_at_boundary_layer, double distance,
+    double coriolis, double gahm_holland_b, double central_pressure,
+    double background_pressure) -> std::tuple<double, double> {
+  const auto rossby = Gahm::Physical::Atmospheric::rossbyNumber(
+      vmax_at_boundary_layer, radius_to_max_wind, coriolis);
+  const auto one_plus_inv_rossby = 1.0 + 1.0 / rossby;
+  const auto phi =
+      1.0 + (1.0 / (rossby * gahm_holland_b * one_plus_inv_rossby));
+  const auto rmbg = std::pow(radius_to_max_wind / distance, gahm_holland_b);
+
+  //...exp(phi * (1 - rmbg)) in the wind speed is exp(phi) * exp(-phi * rmbg)
+  const auto exp_pressure = std::exp(-phi * rmbg);
+  const auto exp_wind = std::exp(phi) * exp_pressure;
+
+  const auto half_fr = (distance * coriolis) / 2.0;
+  const auto sign_of_coriolis = coriolis >= 0.0 ? 1.0 : -1.0;
+  const auto wind_speed =
+      sign_of_coriolis *
+          std::sqrt(vmax_at_boundary_layer * vmax_at_boundary_layer *
+                        one_plus_inv_rossby * exp_wind * rmbg +
+                    half_fr * half_fr) -
+      half_fr;
+  const auto pressure = central_pressure + (background_pressure -
+                                            central_pressure) *
+                                               exp_pressure;
+  return {wind_speed, pressure};
+}
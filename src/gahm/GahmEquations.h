@@ -23,6 +23,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <tuple>
 
 #include "physical/Atmospheric.h"
 
@@ -49,6 +50,13 @@ auto GahmFunctionDerivative(double radius_to_max_wind,
                             double coriolis_force, double gahm_holland_b)
     -> double;
 
+auto GahmFunctionAndDerivatives(double radius_to_max_wind,
+                                double vmax_at_boundary_layer,
+                                double isotach_windspeed_at_boundary_layer,
+                                double distance, double coriolis_force,
+                                double gahm_holland_b)
+    -> std::tuple<double, double, double>;
+
 auto GahmPressure(double central_pressure, double background_pressure,
                   double distance, double radius_to_max_winds,
                   double gahm_holland_b, double phi) -> double;
@@ -57,6 +65,13 @@ auto GahmWindSpeed(double radius_to_max_wind, double vmax_at_boundary_layer,
                    double distance, double coriolis, double gahm_holland_b)
     -> double;
 
+auto GahmWindSpeedAndPressure(double radius_to_max_wind,
+                              double vmax_at_boundary_layer, double distance,
+                              double coriolis, double gahm_holland_b,
+                              double central_pressure,
+                              double background_pressure)
+    -> std::tuple<double, double>;
+
 /**
  * Compute the GAHM phi parameter
  * @param vmax maximum storm wind velocity
@@ -20,15 +20,12 @@
 //
 #include "gahm/GahmRadiusSolver.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
-#include <limits>
 #include <string>
 
 #include "boost/math/policies/error_handling.hpp"
-#include "boost/math/tools/roots.hpp"
-#include "boost/throw_exception.hpp"
-
-constexpr size_t c_max_solver_iterations = 200;
 
 namespace Gahm::Solver {
 
@@ -44,29 +41,137 @@ GahmRadiusSolver::GahmRadiusSolver(double isotach_radius, double isotach_speed,
                                    double vmax, double f_coriolis,
                                    double gahm_b)
     : m_solver(isotach_radius, isotach_speed, vmax, f_coriolis, gahm_b),
-      m_max_it(c_max_solver_iterations) {}
+      m_max_it(c_max_iterations),
+      m_iterations(0),
+      m_bisections(0),
+      m_tolerance(c_default_tolerance),
+      m_use_halley(false) {}
 
 /**
  * Runs the solver
+ *
+ * This is a safeguarded Newton iteration, or Halley iteration when enabled.
+ * Each evaluation of the gradient wind function records which side of the
+ * root it fell on. Once both sides have been seen, any step which would leave
+ * the bracket is replaced with a bisection. Before that, a step outside of
+ * the bounds moves halfway to the bound instead and is not used as a test for
+ * convergence. There is no root if the iteration is pushed out of the bounds
+ * from within the tolerance of a bound. The iteration stops when the step is
+ * smaller than the tolerance, which is in meters
+ *
  * @param lower lower bound for solution
  * @param upper upper bound for solution
  * @param guess guess for solution
  * @return radius to maximum winds
  */
-auto GahmRadiusSolver::solve(double lower, double upper, double guess) const
+auto GahmRadiusSolver::solve(double lower, double upper, double guess)
     -> double {
-  auto iter = m_max_it;
-  try {
-    return boost::math::tools::newton_raphson_iterate(
-        m_solver, guess, lower, upper, std::numeric_limits<double>::digits,
-        iter);
-  } catch (const boost::wrapexcept<boost::math::evaluation_error> &e) {
-    auto error =
-        "Unable to solve for radius to maximum winds: " + std::string(e.what());
-    throw boost::math::evaluation_error(error);
+  m_iterations = 0;
+  m_bisections = 0;
+
+  double x = std::clamp(guess, lower, upper);
+  double x_negative = lower;
+  double x_positive = upper;
+  bool has_negative = false;
+  bool has_positive = false;
+
+  while (m_iterations < m_max_it) {
+    m_iterations++;
+    const auto [f, df, d2f] = m_solver(x);
+    if (!std::isfinite(f) || !std::isfinite(df)) {
+      throw boost::math::evaluation_error(
+          "Unable to solve for radius to maximum winds: Function is not "
+          "finite at " +
+          std::to_string(x));
+    }
+    if (f == 0.0) return x;
+
+    if (f < 0.0) {
+      x_negative = x;
+      has_negative = true;
+    } else {
+      x_positive = x;
+      has_positive = true;
+    }
+
+    double step = f / df;
+    if (m_use_halley && std::isfinite(d2f)) {
+      //...Only take the Halley correction when it does not reverse or more
+      // than double the Newton step
+      const double denominator = 1.0 - 0.5 * step * d2f / df;
+      if (denominator > 0.5) step /= denominator;
+    }
+    double x_new = x - step;
+
+    if (has_negative && has_positive) {
+      const auto [lo, hi] = std::minmax(x_negative, x_positive);
+      if (!(x_new > lo && x_new < hi)) {
+        x_new = 0.5 * (lo + hi);
+        m_bisections++;
+      }
+    } else if (!(x_new >= lower && x_new <= upper)) {
+      const double bound = x_new < lower ? lower : upper;
+      if (std::abs(x - bound) < m_tolerance) {
+        throw boost::math::evaluation_error(
+            "Unable to solve for radius to maximum winds: No root between " +
+            std::to_string(lower) + " and " + std::to_string(upper));
+      }
+      x = 0.5 * (x + bound);
+      m_bisections++;
+      continue;
+    }
+
+    if (std::abs(x_new - x) < m_tolerance) return x_new;
+    x = x_new;
   }
+
+  throw boost::math::evaluation_error(
+      "Unable to solve for radius to maximum winds: No convergence after " +
+      std::to_string(m_max_it) + " iterations");
+}
+
+/**
+ * Returns the number of Newton iterations used in the most recent solve
+ * @return Newton iterations
+ */
+auto GahmRadiusSolver::iterations() const -> size_t { return m_iterations; }
+
+/**
+ * Returns the number of iterations in the most recent solve where the Newton
+ * step was replaced with a bisection or a step to a bound
+ * @return bisection steps
+ */
+auto GahmRadiusSolver::bisections() const -> size_t { return m_bisections; }
+
+/**
+ * Sets the convergence tolerance for the radius to maximum winds
+ * @param tolerance tolerance in meters
+ */
+void GahmRadiusSolver::setTolerance(double tolerance) {
+  m_tolerance = tolerance;
+}
+
+/**
+ * Returns the convergence tolerance for the radius to maximum winds
+ * @return tolerance in meters
+ */
+auto GahmRadiusSolver::tolerance() const -> double { return m_tolerance; }
+
+/**
+ * Selects Halley's method, which uses the second derivative, instead of
+ * Newton's method
+ * @param use_halley true to use Halley's method
+ */
+void GahmRadiusSolver::setUseHalley(bool use_halley) {
+  m_use_halley = use_halley;
 }
 
+/**
+ * Returns true if Halley's method is used
+ * @return Halley's method status
+ */
+auto GahmRadiusSolver::useHalley() const -> bool { return m_use_halley; }
+
 /**
  * Allows user to change the GAHM Holland B parameter for additional solver
  * iterations
@@ -28,11 +28,27 @@
 namespace Gahm::Solver {
 class GahmRadiusSolver {
  public:
+  static constexpr size_t c_max_iterations = 200;
+
+  //...Default convergence tolerance for the radius to max winds in meters
+  static constexpr double c_default_tolerance = 1.0e-3;
+
   GahmRadiusSolver(double isotach_radius, double isotach_speed, double vmax,
                    double f_coriolis, double gahm_b);
 
-  [[nodiscard]] auto solve(double lower, double upper, double guess) const
-      -> double;
+  [[nodiscard]] auto solve(double lower, double upper, double guess) -> double;
+
+  [[nodiscard]] auto iterations() const -> size_t;
+
+  [[nodiscard]] auto bisections() const -> size_t;
+
+  void setTolerance(double tolerance);
+
+  [[nodiscard]] auto tolerance() const -> double;
+
+  void setUseHalley(bool use_halley);
+
+  [[nodiscard]] auto useHalley() const -> bool;
 
   void setGahmB(double gahm_b);
 
@@ -41,6 +57,10 @@ class GahmRadiusSolver {
  private:
   GahmRadiusSolverPrivate m_solver;
   size_t m_max_it;
+  size_t m_iterations;
+  size_t m_bisections;
+  double m_tolerance;
+  bool m_use_halley;
 };
 }  // namespace Gahm::Solver
 #endif  // GAHM_SRC_GAHMRADIUSSOLVER_H_
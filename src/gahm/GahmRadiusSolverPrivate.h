@@ -23,7 +23,7 @@
 
 #include <cassert>
 #include <cmath>
-#include <utility>
+#include <tuple>
 
 #include "physical/Atmospheric.h"
 #include "physical/Constants.h"
@@ -36,19 +36,12 @@ class GahmRadiusSolverPrivate {
                           double vmax, double f_coriolis, double gahm_b);
 
   [[nodiscard]] auto operator()(const double &radiusToMaxWinds) const
-      -> std::pair<double, double>;
+      -> std::tuple<double, double, double>;
 
   void setGahmB(double gahm_b);
   [[nodiscard]] auto gahm_b() const -> double;
 
  private:
-  static auto f(double radius_to_max_winds, double vmax, double isotach_speed,
-                double isotach_radius, double f_coriolis, double gahm_b)
-      -> double;
-  static auto f_prime(double radius_to_max_winds, double vmax,
-                      double isotach_radius, double f_coriolis, double gahm_b)
-      -> double;
-
   double m_isotachRadius;
   double m_vmax;
   double m_f_coriolis;
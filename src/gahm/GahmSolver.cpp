@@ -56,19 +56,61 @@ GahmSolver::GahmSolver(double isotach_radius, double isotach_speed, double vmax,
           GahmSolver::estimateRmax(m_pbk - m_pc, latitude, isotach_radius)),
       m_rmax(std::numeric_limits<double>::max()),
       m_bg(Gahm::Physical::Atmospheric::calcHollandB(m_vmax, m_pc, m_pbk)),
-      m_bg_tol(1e-9),
+      m_bg_tol(c_gahm_b_tolerance),
       m_phi(1.0),
-      m_max_it(200),
+      m_max_it(c_max_iterations),
       m_it(0),
+      m_newton_it(0),
+      m_warm_start(false),
       m_solver(m_isotachRadius, m_isotachSpeed, m_vmax, m_fc, m_bg) {}
 
+/**
+ * Seeds the solver with the solution to a similar problem, such as a
+ * neighbouring quadrant of the same storm. The radius to maximum winds is used
+ * as the initial guess and the GAHM Holland B replaces the standard Holland B
+ * as the starting point of the outer iteration. Each outer iteration after the
+ * first then starts from the previous radius to maximum winds. Seeds which are
+ * not usable are ignored and the solver starts from its own estimate
+ * @param rmax radius to maximum winds of the neighbouring solution
+ * @param gahm_b GAHM Holland B of the neighbouring solution
+ */
+void GahmSolver::warmStart(const double rmax, const double gahm_b) {
+  if (!std::isfinite(rmax) || !std::isfinite(gahm_b) || rmax <= 1.0 ||
+      gahm_b <= 0.0) {
+    return;
+  }
+  m_rmax_guess = std::min(rmax, 0.99 * m_isotachRadius);
+  m_bg = gahm_b;
+  m_solver.setGahmB(m_bg);
+  m_warm_start = true;
+}
+
+/**
+ * Sets the convergence tolerance of the radius to maximum winds in each
+ * Newton solve
+ * @param tolerance tolerance in meters
+ */
+void GahmSolver::setRadiusTolerance(double tolerance) {
+  m_solver.setTolerance(tolerance);
+}
+
+/**
+ * Selects Halley's method instead of Newton's method for the radius to
+ * maximum winds
+ * @param use_halley true to use Halley's method
+ */
+void GahmSolver::setUseHalley(bool use_halley) {
+  m_solver.setUseHalley(use_halley);
+}
+
 /**
  * Runs the solver and stores the solution internally
  */
 void GahmSolver::solve() {
-  const auto guess = m_rmax_guess;
+  auto guess = m_rmax_guess;
   for (size_t i = 0; i < m_max_it; ++i) {
     auto new_rmax = m_solver.solve(1.0, m_isotachRadius, guess);
+    m_newton_it += m_solver.iterations();
     if (!std::isnan(new_rmax) && !std::isinf(new_rmax) &&
         new_rmax != std::numeric_limits<double>::max()) {
       m_rmax = new_rmax;
@@ -77,7 +119,7 @@ void GahmSolver::solve() {
     m_phi = GahmEquations::phi(m_vmax, m_rmax, m_bg, m_fc);
     m_bg = GahmEquations::gahm_b(m_vmax, m_rmax, m_pc, m_pbk, m_fc, m_phi);
     if (std::abs(m_bg - m_solver.gahm_b()) < m_bg_tol) {
-      m_it = i;
+      m_it = i + 1;
       break;
     }
     if (std::isnan(new_rmax) || std::isinf(new_rmax) || std::isnan(m_bg) ||
@@ -86,6 +128,9 @@ void GahmSolver::solve() {
           std::string("Solution did not converge."));
     }
     m_solver.setGahmB(m_bg);
+    if (m_warm_start) {
+      guess = m_rmax;
+    }
   }
   assert(this->rmax() > 0.0);
   assert(this->gahm_b() > 0.0);
@@ -160,11 +205,25 @@ auto GahmSolver::gahm_b() const -> double {
 }
 
 /**
- * Returns the number of iterations used in the GAHM Holland B solver
- * @return
+ * Returns the number of outer iterations used in the GAHM Holland B solver.
+ * This is zero until the solver has converged
+ * @return number of outer iterations
  */
 auto GahmSolver::it() const -> size_t { return m_it; }
 
+/**
+ * Returns the total number of Newton iterations used by the radius solver
+ * across all outer iterations
+ * @return number of Newton iterations
+ */
+auto GahmSolver::newtonIterations() const -> size_t { return m_newton_it; }
+
+/**
+ * Returns true if the solver was seeded by a call to warmStart
+ * @return warm start status
+ */
+auto GahmSolver::isWarmStarted() const -> bool { return m_warm_start; }
+
 /*
  * Returns the solution to the GAHM phi parameter. Note that when the
  * solver has not run, the solution is 1.0
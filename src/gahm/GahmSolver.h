@@ -29,9 +29,18 @@ namespace Gahm::Solver {
 
 class GahmSolver {
  public:
+  static constexpr size_t c_max_iterations = 200;
+  static constexpr double c_gahm_b_tolerance = 1e-9;
+
   GahmSolver(double isotach_radius, double isotach_speed, double vmax,
              double p_center, double p_background, double latitude);
 
+  void warmStart(double rmax, double gahm_b);
+
+  void setRadiusTolerance(double tolerance);
+
+  void setUseHalley(bool use_halley);
+
   void solve();
 
   [[nodiscard]] auto isotachRadius() const -> double;
@@ -56,9 +65,13 @@ class GahmSolver {
 
   [[nodiscard]] auto it() const -> size_t;
 
- private:
+  [[nodiscard]] auto newtonIterations() const -> size_t;
+
+  [[nodiscard]] auto isWarmStarted() const -> bool;
+
   static auto estimateRmax(double dp, double lat, double isorad) -> double;
 
+ private:
   double m_isotachRadius;
   double m_isotachSpeed;
   double m_vmax;
@@ -73,6 +86,8 @@ class GahmSolver {
   double m_phi;
   size_t m_max_it;
   size_t m_it;
+  size_t m_newton_it;
+  bool m_warm_start;
   GahmRadiusSolver m_solver;
 };
 }  // namespace Gahm::Solver
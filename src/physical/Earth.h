@@ -21,6 +21,7 @@
 #ifndef GAHM_SRC_EARTH_H_
 #define GAHM_SRC_EARTH_H_
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <tuple>
@@ -57,6 +58,24 @@ constexpr auto equatorialRadius() -> double { return 6378137.0; }
  */
 constexpr auto polarRadius() -> double { return 6356752.3; }
 
+/*
+ * Earth radius in meters at a latitude given by the square of its cosine
+ * See
+ * https://en.wikipedia.org/wiki/Earth_radius#Radius_at_a_given_geodetic_latitude
+ * for derivation
+ * @param cos2_lat Square of the cosine of the latitude
+ * @return Earth radius in meters
+ */
+static auto radiusFromCosSquared(const double cos2_lat) -> double {
+  constexpr double a2 = equatorialRadius() * equatorialRadius();
+  constexpr double b2 = polarRadius() * polarRadius();
+  constexpr double a4 = a2 * a2;
+  constexpr double b4 = b2 * b2;
+  const double sin2_lat = 1.0 - cos2_lat;
+  return std::sqrt((a4 * cos2_lat + b4 * sin2_lat) /
+                   (a2 * cos2_lat + b2 * sin2_lat));
+}
+
 /*
  * Earth radius in meters at a given latitude
  * Default latitude is the equator
@@ -72,14 +91,8 @@ static auto radius(const double latitude = std::numeric_limits<double>::max())
     return equatorialRadius();
   }
   const double lat_radians = Gahm::Physical::Constants::deg2rad() * latitude;
-  return std::sqrt((std::pow(equatorialRadius(), 4.0) * std::cos(lat_radians) *
-                        std::cos(lat_radians) +
-                    std::pow(polarRadius(), 4.0) * std::sin(lat_radians) *
-                        std::sin(lat_radians)) /
-                   (std::pow(equatorialRadius(), 2.0) * std::cos(lat_radians) *
-                        std::cos(lat_radians) +
-                    std::pow(polarRadius(), 2.0) * std::sin(lat_radians) *
-                        std::sin(lat_radians)));
+  const double cos_lat = std::cos(lat_radians);
+  return radiusFromCosSquared(cos_lat * cos_lat);
 }
 
 /*
@@ -162,6 +175,50 @@ static auto azimuth(const Gahm::Datatypes::Point &point_0,
   return azimuth(point_0.x(), point_0.y(), point_1.x(), point_1.y());
 }
 
+/*
+ * Distance and azimuth between two points on the earth's surface computed from
+ * the precomputed sines and cosines of their latitudes and longitudes. This
+ * is equivalent to calling distance() and azimuth() with the same points, but
+ * only requires one sqrt/asin pair for the distance, one sqrt for the earth
+ * radius and one atan2 for the azimuth
+ * @param sin_lat1 Sine of latitude 1
+ * @param cos_lat1 Cosine of latitude 1
+ * @param sin_lon1 Sine of longitude 1
+ * @param cos_lon1 Cosine of longitude 1
+ * @param sin_lat2 Sine of latitude 2
+ * @param cos_lat2 Cosine of latitude 2
+ * @param sin_lon2 Sine of longitude 2
+ * @param cos_lon2 Cosine of longitude 2
+ * @return Tuple of the distance in meters and the azimuth in radians
+ */
+static auto distanceAndAzimuth(const double sin_lat1, const double cos_lat1,
+                               const double sin_lon1, const double cos_lon1,
+                               const double sin_lat2, const double cos_lat2,
+                               const double sin_lon2, const double cos_lon2)
+    -> std::tuple<double, double> {
+  //...Angle addition identities for the longitude difference (lon2 - lon1)
+  const double sin_dx = sin_lon2 * cos_lon1 - cos_lon2 * sin_lon1;
+  const double cos_dx = cos_lon2 * cos_lon1 + sin_lon2 * sin_lon1;
+
+  //...Haversine term written in terms of the cosine of the central angle
+  const double cos_c = sin_lat1 * sin_lat2 + cos_lat1 * cos_lat2 * cos_dx;
+  const double a = std::min(1.0, std::max(0.0, 0.5 * (1.0 - cos_c)));
+  const double c = 2.0 * std::asin(std::sqrt(a));
+
+  //...Earth radius at the mean latitude, cos^2((lat1 + lat2) / 2)
+  const double cos2_mean =
+      0.5 * (1.0 + cos_lat1 * cos_lat2 - sin_lat1 * sin_lat2);
+  const double dist = radiusFromCosSquared(cos2_mean) * c;
+
+  const double ay = sin_dx * cos_lat2;
+  const double ax = cos_lat1 * sin_lat2 - sin_lat1 * cos_lat2 * cos_dx;
+  auto azi = std::atan2(-ay, -ax);
+  if (azi < 0.0) {
+    azi += Physical::Constants::twoPi();
+  }
+  return {dist, azi};
+}
+
 /*
  * Compute the spherical distance between two points on the earth's surface
  * as well as at the mean latitudes/longitudes between the points
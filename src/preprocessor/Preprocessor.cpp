@@ -22,18 +22,30 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <iterator>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "atcf/AtcfFile.h"
 #include "atcf/AtcfIsotach.h"
 #include "atcf/AtcfQuadrant.h"
 #include "atcf/AtcfSnap.h"
 #include "atcf/StormTranslation.h"
+#include "boost/math/policies/error_handling.hpp"
+#include "gahm/GahmBatchSolver.h"
+#include "gahm/GahmRadiusSolver.h"
 #include "gahm/GahmSolver.h"
 #include "physical/Constants.h"
 #include "physical/Earth.h"
+#include "preprocessor/SolutionCache.h"
+#include "util/Parallel.h"
 
 namespace Gahm {
 
@@ -42,7 +54,7 @@ namespace Gahm {
  * @param atcf Pointer to the AtcfFile object
  */
 Preprocessor::Preprocessor(Gahm::Atcf::AtcfFile *atcf, bool do_initialization)
-    : m_atcf(atcf), m_isotachsProcessed(false) {
+    : m_atcf(atcf) {
   if (do_initialization) {
     this->prepareAtcfData();
   }
@@ -50,73 +62,455 @@ Preprocessor::Preprocessor(Gahm::Atcf::AtcfFile *atcf, bool do_initialization)
 
 /*
  * Prepares the ATCF data for the solver
+ *
+ * Only snaps which are new or whose inputs changed since they were last
+ * prepared are processed, so the method can be called again after snaps are
+ * appended to the track. The inputs of a snap include the date and position of
+ * the neighbour its translation is computed from, so a change to one snap also
+ * prepares the snap after it again. A snap which is prepared is solved again by
+ * the next call to solve()
  */
 void Preprocessor::prepareAtcfData() {
-  if (!m_isotachsProcessed) {
-    this->orderIsotachs();
-    this->fillMissingAtcfData();
-    this->computeStormTranslationVelocities();
-    this->computeBoundaryLayerWindspeed();
-    this->processIsotachRadii();
-    this->m_isotachsProcessed = true;
+  const Atcf::AtcfFile &atcf = *m_atcf;
+  std::unordered_map<int64_t, t_snap_state> snap_state;
+  bool modified = false;
+  for (size_t i = 0; i < atcf.size(); ++i) {
+    const auto key = atcf.at(i).date().toMSeconds();
+    auto inputs = this->snapInputs(i);
+    const auto previous = m_snap_state.find(key);
+    if (previous != m_snap_state.end() && previous->second.inputs == inputs) {
+      snap_state.emplace(key, std::move(previous->second));
+      continue;
+    }
+    this->prepareSnap(i);
+    snap_state.emplace(key, t_snap_state{this->snapInputs(i), false});
+    modified = true;
+  }
+  m_snap_state = std::move(snap_state);
+  m_prepared = true;
+  if (modified) m_atcf->markModified();
+}
+
+/**
+ * Returns the values of a snap which are used to prepare and solve it, in the
+ * form they are compared to detect a change. This includes the date and
+ * position of the neighbouring snap used for the storm translation
+ * @param index Index of the snap
+ * @return Inputs of the snap
+ */
+auto Preprocessor::snapInputs(size_t index) const -> std::vector<double> {
+  const Atcf::AtcfFile &atcf = *m_atcf;
+  const auto &snap = atcf.at(index);
+  std::vector<double> inputs{
+      static_cast<double>(snap.date().toMSeconds()), snap.position().x(),
+      snap.position().y(), snap.centralPressure(), snap.backgroundPressure(),
+      snap.radiusToMaxWinds(), snap.vmax()};
+
+  const size_t neighbour = index > 0 ? index - 1 : 1;
+  if (neighbour < atcf.size()) {
+    const auto &other = atcf.at(neighbour);
+    inputs.push_back(static_cast<double>(other.date().toMSeconds()));
+    inputs.push_back(other.position().x());
+    inputs.push_back(other.position().y());
+  }
+
+  for (const auto &isotach : snap.isotachs()) {
+    inputs.push_back(isotach.windSpeed());
+    for (const auto &quadrant : isotach.quadrants()) {
+      inputs.push_back(quadrant.isotachRadius());
+    }
   }
+  return inputs;
+}
+
+/**
+ * Prepares a single snap for the solver
+ * @param index Index of the snap
+ */
+void Preprocessor::prepareSnap(size_t index) {
+  auto &snap = m_atcf->at(index);
+  snap.orderIsotachs();
+  Preprocessor::fillMissingAtcfData(snap);
+  this->computeStormTranslationVelocity(index);
+  Preprocessor::computeBoundaryLayerWindspeed(snap);
+  snap.processIsotachRadii();
 }
 
 /*
  * Calculates the radius to maximum wind speed and GAHM B for each quadrant
+ *
+ * Snaps which are new or have changed are prepared first (see
+ * prepareAtcfData), and only snaps which have not been solved since they were
+ * last prepared are solved. A snap with a quadrant that fails to solve is
+ * attempted again by the next call. Use invalidate() to solve every snap
+ * again.
+ *
+ * The snaps are solved in parallel. Within a snap the quadrants are solved in
+ * order, so with warm starts enabled each quadrant is seeded from a neighbour
+ * that has already been solved: the previous quadrant of the same isotach, or
+ * for the first quadrant, the same quadrant of the previous isotach. The first
+ * quadrant of each snap and any quadrant whose neighbour failed start cold.
+ * Seeds never cross a snap, so the results do not depend on the thread count.
+ * A warm start which fails is retried from the cold start.
+ *
+ * With batch solves enabled, all quadrants of a snap are instead solved
+ * together in lockstep by the GahmBatchSolver. Warm starts do not apply since
+ * no quadrant is solved before its neighbours.
+ *
+ * When a SolutionCache is set, quadrants whose inputs are in the cache take
+ * their solution from it and are not solved. New solutions are added to the
+ * cache, which is then saved. The key includes whether the batch solver is
+ * used, so scalar and batch solutions are kept apart. A warm started solution
+ * also depends on the neighbour it was seeded from, which is not part of the
+ * key, so the cache is not used when warm starts are enabled.
+ *
+ * A quadrant which fails to solve does not stop the others. Every failure is
+ * collected and reported in a single exception once all quadrants have been
+ * attempted
  */
 void Preprocessor::solve() {
-  if (!m_isotachsProcessed) {
+  if (!m_prepared) {
     throw std::runtime_error(
         "Isotach radii have not been processed. Please call "
         "Preprocessor::prepareAtcfData() before calling "
         "Preprocessor::solve().");
   }
+  this->prepareAtcfData();
+
+  struct t_task {
+    const Atcf::AtcfSnap *snap;
+    size_t isotach_index;
+    Atcf::AtcfQuadrant *quadrant;
+    const Atcf::AtcfQuadrant *seed;
+    bool solved;
+    bool cached;
+    t_solve_statistics statistics;
+  };
+
+  std::vector<t_snap_state *> snaps;
+  std::vector<t_task> tasks;
+  std::vector<size_t> snap_offsets{0};
+  const Atcf::AtcfFile &atcf = *m_atcf;
+  for (size_t index = 0; index < atcf.size(); ++index) {
+    //...The snap is only taken through the non-const accessor, which marks
+    // the track as modified, when it is going to be solved
+    auto &state = m_snap_state.at(atcf.at(index).date().toMSeconds());
+    if (state.solved) continue;
+    auto &snap = m_atcf->at(index);
+    snaps.push_back(&state);
+    for (size_t i = 0; i < snap.isotachs().size(); ++i) {
+      for (auto &quadrant : snap.isotachs()[i].quadrants()) {
+        tasks.push_back({&snap, i, &quadrant, nullptr, false, false, {}});
+      }
+    }
+    snap_offsets.push_back(tasks.size());
+  }
 
-  for (auto &snap : m_atcf->data()) {
-    const double p_min = snap.centralPressure();
-    const double p_back = snap.backgroundPressure();
-    const double latitude = snap.position().y();
-
-    for (auto &isotach : snap.isotachs()) {
-      for (auto &quadrant : isotach.quadrants()) {
-        const double isotach_radius = quadrant.isotachRadius();
-
-        const double isotach_speed = quadrant.isotachSpeedAtBoundaryLayer();
-        double vmax = quadrant.vmaxAtBoundaryLayer();
-
-        //...Nudge the vmax to be greater than the isotach speed
-        // TODO: Confirm with Rick if this is necessary
-        if (vmax <= isotach_speed) {
-          vmax = isotach_speed + 1.0;
-        }
+  //...Index of the task used to seed a warm start, or the task itself when
+  // there is no neighbour
+  constexpr size_t n_quadrants = 4;
+  const auto seedIndex = [&](const size_t snap_begin, const size_t i) {
+    const auto local = i - snap_begin;
+    if (local % n_quadrants > 0) return i - 1;
+    if (local >= n_quadrants) return i - n_quadrants;
+    return i;
+  };
+
+  const auto boundaryLayerVmax = [](const Atcf::AtcfQuadrant &quadrant) {
+    const double isotach_speed = quadrant.isotachSpeedAtBoundaryLayer();
+    double vmax = quadrant.vmaxAtBoundaryLayer();
+
+    //...Nudge the vmax to be greater than the isotach speed
+    // TODO: Confirm with Rick if this is necessary
+    if (vmax <= isotach_speed) {
+      vmax = isotach_speed + 1.0;
+    }
+    return vmax;
+  };
+
+  //...Inputs of the solve for a quadrant and the configuration of the solver,
+  // which identify it in the cache. The solvers are used with their default
+  // tolerance and Newton steps
+  const uint64_t solver_flags =
+      m_batch_solve ? SolutionCache::c_solver_batch : uint64_t{0};
+  const auto cacheKey = [&](const t_task &task) {
+    const auto &quadrant = *task.quadrant;
+    return SolutionCache::t_key{
+        quadrant.isotachRadius(),
+        quadrant.isotachSpeedAtBoundaryLayer(),
+        boundaryLayerVmax(quadrant),
+        task.snap->centralPressure(),
+        task.snap->backgroundPressure(),
+        task.snap->position().y(),
+        Gahm::Solver::GahmRadiusSolver::c_default_tolerance,
+        solver_flags};
+  };
+  const bool use_cache =
+      m_solution_cache != nullptr && (m_batch_solve || !m_warm_start);
+
+  //...Quadrants found in the cache are not solved again. The lookups are made
+  // in order before the parallel solve, so the order of use recorded by the
+  // cache does not depend on the thread count
+  if (use_cache) {
+    for (auto &task : tasks) {
+      const auto solution = m_solution_cache->find(cacheKey(task));
+      if (!solution) continue;
+      task.quadrant->setRadiusToMaxWindSpeed(solution->rmax);
+      task.quadrant->setGahmHollandB(solution->gahm_b);
+      task.solved = true;
+      task.cached = true;
+      task.statistics.quadrants = 1;
+      task.statistics.cache_hits = 1;
+    }
+  }
 
-        Gahm::Solver::GahmSolver solver(isotach_radius, isotach_speed, vmax,
-                                        p_min, p_back, latitude);
+  //...Solves a single quadrant and returns the error message if it fails
+  const auto solveQuadrant = [&](t_task &task, const bool warm) -> std::string {
+    const auto &snap = *task.snap;
+    auto &quadrant = *task.quadrant;
+    const double isotach_speed = quadrant.isotachSpeedAtBoundaryLayer();
+    const double vmax = boundaryLayerVmax(quadrant);
+
+    std::string error;
+    try {
+      Gahm::Solver::GahmSolver solver(
+          quadrant.isotachRadius(), isotach_speed, vmax,
+          snap.centralPressure(), snap.backgroundPressure(),
+          snap.position().y());
+      if (warm) {
+        solver.warmStart(task.seed->radiusToMaxWindSpeed(),
+                         task.seed->gahmHollandB());
+        task.statistics.warm_starts +=
+            solver.isWarmStarted() ? size_t{1} : size_t{0};
+      }
+      try {
         solver.solve();
         quadrant.setRadiusToMaxWindSpeed(solver.rmax());
         quadrant.setGahmHollandB(solver.gahm_b());
+      } catch (const std::exception &e) {
+        error = e.what();
       }
+      task.statistics.outer_iterations += solver.it();
+      task.statistics.newton_iterations += solver.newtonIterations();
+    } catch (const std::exception &e) {
+      error = e.what();
+    }
+    task.solved = error.empty();
+    return error;
+  };
+
+  std::vector<std::string> errors(tasks.size());
+
+  //...Solves every quadrant of a snap which is not cached together with the
+  // batch solver
+  const auto solveSnapBatch = [&](const size_t begin, const size_t end) {
+    std::vector<size_t> lanes;
+    for (size_t i = begin; i < end; ++i) {
+      if (!tasks[i].cached) lanes.push_back(i);
+    }
+    if (lanes.empty()) return;
+
+    const auto &snap = *tasks[begin].snap;
+    Gahm::Solver::GahmBatchSolver solver(snap.centralPressure(),
+                                         snap.backgroundPressure(),
+                                         snap.position().y());
+    for (const auto i : lanes) {
+      const auto &quadrant = *tasks[i].quadrant;
+      solver.addQuadrant(quadrant.isotachRadius(),
+                         quadrant.isotachSpeedAtBoundaryLayer(),
+                         boundaryLayerVmax(quadrant));
+    }
+    solver.solve();
+
+    for (size_t lane = 0; lane < lanes.size(); ++lane) {
+      const size_t i = lanes[lane];
+      auto &task = tasks[i];
+      task.statistics.quadrants = 1;
+      task.statistics.outer_iterations = solver.it(lane);
+      task.statistics.newton_iterations = solver.newtonIterations(lane);
+      task.solved = solver.converged(lane);
+      if (task.solved) {
+        task.quadrant->setRadiusToMaxWindSpeed(solver.rmax(lane));
+        task.quadrant->setGahmHollandB(solver.gahm_b(lane));
+      } else {
+        errors[i] = solver.error(lane);
+      }
+    }
+  };
+
+  Gahm::detail::Parallel::parallelFor(
+      snaps.size(), 1, m_thread_count,
+      [&](const size_t begin, const size_t end) {
+        for (size_t s = begin; s < end; ++s) {
+          if (m_batch_solve) {
+            solveSnapBatch(snap_offsets[s], snap_offsets[s + 1]);
+            continue;
+          }
+          for (size_t i = snap_offsets[s]; i < snap_offsets[s + 1]; ++i) {
+            auto &task = tasks[i];
+            if (task.cached) continue;
+            const auto seed = seedIndex(snap_offsets[s], i);
+            const bool warm =
+                m_warm_start && seed != i && tasks[seed].solved;
+            if (warm) task.seed = tasks[seed].quadrant;
+            task.statistics.quadrants = 1;
+
+            errors[i] = solveQuadrant(task, warm);
+            if (warm && !task.solved) {
+              task.statistics.cold_restarts = 1;
+              errors[i] = solveQuadrant(task, false);
+            }
+          }
+        }
+      });
+
+  if (use_cache) {
+    bool added = false;
+    for (const auto &task : tasks) {
+      if (!task.solved || task.cached) continue;
+      m_solution_cache->insert(cacheKey(task),
+                               {task.quadrant->radiusToMaxWindSpeed(),
+                                task.quadrant->gahmHollandB()});
+      added = true;
     }
+    if (added) m_solution_cache->save();
+  }
+
+  //...A snap is solved once all of its quadrants are
+  for (size_t s = 0; s < snaps.size(); ++s) {
+    const auto first = errors.begin();
+    snaps[s]->solved = std::all_of(
+        first + static_cast<std::ptrdiff_t>(snap_offsets[s]),
+        first + static_cast<std::ptrdiff_t>(snap_offsets[s + 1]),
+        [](const std::string &error) { return error.empty(); });
+  }
+  if (!snaps.empty()) m_atcf->markModified();
+
+  m_statistics = t_solve_statistics();
+  m_statistics.snaps = snaps.size();
+  std::string message;
+  size_t n_failed = 0;
+  for (size_t i = 0; i < tasks.size(); ++i) {
+    const auto &stats = tasks[i].statistics;
+    m_statistics.quadrants += stats.quadrants;
+    m_statistics.outer_iterations += stats.outer_iterations;
+    m_statistics.newton_iterations += stats.newton_iterations;
+    m_statistics.warm_starts += stats.warm_starts;
+    m_statistics.cold_restarts += stats.cold_restarts;
+    m_statistics.cache_hits += stats.cache_hits;
+
+    if (errors[i].empty()) continue;
+    n_failed++;
+    message += "\n  " + tasks[i].snap->date().toString("%Y-%m-%d %H:%M") +
+               ", isotach " + std::to_string(tasks[i].isotach_index) +
+               ", quadrant " +
+               std::to_string(tasks[i].quadrant->quadrantIndex()) + ": " +
+               errors[i];
+  }
+  if (n_failed > 0) {
+    throw boost::math::evaluation_error(
+        "Unable to solve " + std::to_string(n_failed) + " of " +
+        std::to_string(tasks.size()) + " quadrants:" + message);
   }
 }
 
 /**
- * Fills in missing quadrant data in the Isotach objects
+ * Marks every snap as unsolved, so the next call to solve() solves the whole
+ * track again. This is used after changing the solver settings
  */
-void Preprocessor::fillMissingAtcfData() {
-  for (auto &snap : m_atcf->data()) {
-    for (auto &isotach : snap.isotachs()) {
-      const auto n_missing = Preprocessor::countMissingIsotachRadii(isotach);
-      if (n_missing == 1) {
-        Preprocessor::computeSingleMissingIsotachRadius(isotach);
-      } else if (n_missing == 2) {
-        Preprocessor::computeTwoMissingIsotachRadii(isotach);
-      } else if (n_missing == 3) {
-        Preprocessor::ComputeThreeMissingIsotachRadii(isotach);
-      } else if (n_missing == 4) {
-        Preprocessor::setAllIsotachRadiiToRmax(snap, isotach);
-      }
+void Preprocessor::invalidate() {
+  for (auto &state : m_snap_state) {
+    state.second.solved = false;
+  }
+}
+
+/**
+ * Sets the number of threads used to solve the quadrants. A value of zero
+ * uses all available hardware threads
+ * @param thread_count Number of threads
+ */
+void Preprocessor::setThreadCount(size_t thread_count) {
+  m_thread_count = thread_count;
+}
+
+/**
+ * Returns the number of threads used to solve the quadrants
+ * @return Number of threads
+ */
+auto Preprocessor::threadCount() const -> size_t { return m_thread_count; }
+
+/**
+ * Enables seeding each quadrant solve from an already solved neighbour. This
+ * reduces the number of solver iterations, and the solution agrees with the
+ * cold start to within the solver tolerance
+ * @param warm_start True to enable warm starts
+ */
+void Preprocessor::setWarmStart(bool warm_start) { m_warm_start = warm_start; }
+
+/**
+ * Returns true if quadrant solves are seeded from their neighbours
+ * @return Warm start status
+ */
+auto Preprocessor::warmStart() const -> bool { return m_warm_start; }
+
+/**
+ * Enables solving all quadrants of a snap together with the batch solver,
+ * which vectorizes the Newton iterations across the quadrants
+ * @param batch_solve True to enable batch solves
+ */
+void Preprocessor::setBatchSolve(bool batch_solve) {
+  m_batch_solve = batch_solve;
+}
+
+/**
+ * Returns true if the quadrants of each snap are solved together
+ * @return Batch solve status
+ */
+auto Preprocessor::batchSolve() const -> bool { return m_batch_solve; }
+
+/**
+ * Sets a cache of solver results. Quadrants whose inputs are in the cache are
+ * not solved, and new solutions are added to the cache and saved at the end
+ * of solve(). The cache is not used while warm starts are enabled, since a
+ * warm started solution depends on more than the inputs of its quadrant. The
+ * cache is not owned by the preprocessor
+ * @param cache Solution cache, or nullptr to solve every quadrant
+ */
+void Preprocessor::setSolutionCache(SolutionCache *cache) {
+  m_solution_cache = cache;
+}
+
+/**
+ * Returns the cache of solver results
+ * @return Solution cache, or nullptr if there is none
+ */
+auto Preprocessor::solutionCache() const -> SolutionCache * {
+  return m_solution_cache;
+}
+
+/**
+ * Returns the iteration counts from the most recent call to solve
+ * @return Solver statistics
+ */
+auto Preprocessor::solveStatistics() const -> const t_solve_statistics & {
+  return m_statistics;
+}
+
+/**
+ * Fills in missing quadrant data in the Isotach objects of a snap
+ * @param snap Snap object
+ */
+void Preprocessor::fillMissingAtcfData(Atcf::AtcfSnap &snap) {
+  for (auto &isotach : snap.isotachs()) {
+    const auto n_missing = Preprocessor::countMissingIsotachRadii(isotach);
+    if (n_missing == 1) {
+      Preprocessor::computeSingleMissingIsotachRadius(isotach);
+    } else if (n_missing == 2) {
+      Preprocessor::computeTwoMissingIsotachRadii(isotach);
+    } else if (n_missing == 3) {
+      Preprocessor::ComputeThreeMissingIsotachRadii(isotach);
+    } else if (n_missing == 4) {
+      Preprocessor::setAllIsotachRadiiToRmax(snap, isotach);
     }
   }
 }
@@ -201,23 +595,19 @@ void Preprocessor::computeSingleMissingIsotachRadius(
 }
 
 /*
- * Computes the storm translation velocities
+ * Computes the storm translation velocity of a snap from the previous snap, or
+ * for the first snap, from the next snap
+ * @param index Index of the snap
  */
-void Preprocessor::computeStormTranslationVelocities() {
-  for (auto it = m_atcf->data().begin(); it != m_atcf->data().end(); ++it) {
-    if (it == m_atcf->data().begin()) {
-      const auto next = std::next(it);
-      if (next == m_atcf->data().end()) {
-        it->setTranslation({0.0, 0.0});
-      } else {
-        const auto translation = Preprocessor::getTranslation(*it, *next);
-        it->setTranslation(translation);
-      }
-    } else {
-      const auto prev = std::prev(it);
-      const auto translation = Preprocessor::getTranslation(*prev, *it);
-      it->setTranslation(translation);
-    }
+void Preprocessor::computeStormTranslationVelocity(size_t index) {
+  auto &snap = m_atcf->at(index);
+  if (index > 0) {
+    snap.setTranslation(
+        Preprocessor::getTranslation(m_atcf->at(index - 1), snap));
+  } else if (m_atcf->size() > 1) {
+    snap.setTranslation(Preprocessor::getTranslation(snap, m_atcf->at(1)));
+  } else {
+    snap.setTranslation({0.0, 0.0});
   }
 }
 
@@ -312,49 +702,28 @@ auto Preprocessor::removeTranslationVelocity(
 }
 
 /**
- * Computes the boundary layer wind speeds for each snap
+ * Computes the boundary layer wind speeds for a snap
+ * @param snap Snap object
  */
-void Preprocessor::computeBoundaryLayerWindspeed() {
-  for (auto &snap : m_atcf->data()) {
-    double vmax =
-        snap.vmax() * Physical::Constants::tenMeterToTopOfBoundaryLayer();
-    vmax =
-        Preprocessor::removeTranslationVelocity(vmax, vmax, snap.translation());
-    snap.setVmaxBoundaryLayer(vmax);
-
-    for (auto &iso : snap.isotachs()) {
-      for (auto &quad : iso.quadrants()) {
-        double isotach_boundarylayer_speed =
-            Preprocessor::removeTranslationVelocity(
-                iso.windSpeed(), snap.vmaxBoundaryLayer(),
-                quad.quadrantIndex(), snap.translation(),
-                snap.position().y());
-        isotach_boundarylayer_speed *=
-            Physical::Constants::tenMeterToTopOfBoundaryLayer();
-        quad.setIsotachSpeedAtBoundaryLayer(isotach_boundarylayer_speed);
-        quad.setVmaxAtBoundaryLayer(snap.vmaxBoundaryLayer());
-      }
+void Preprocessor::computeBoundaryLayerWindspeed(Atcf::AtcfSnap &snap) {
+  double vmax =
+      snap.vmax() * Physical::Constants::tenMeterToTopOfBoundaryLayer();
+  vmax =
+      Preprocessor::removeTranslationVelocity(vmax, vmax, snap.translation());
+  snap.setVmaxBoundaryLayer(vmax);
+
+  for (auto &iso : snap.isotachs()) {
+    for (auto &quad : iso.quadrants()) {
+      double isotach_boundarylayer_speed =
+          Preprocessor::removeTranslationVelocity(
+              iso.windSpeed(), snap.vmaxBoundaryLayer(), quad.quadrantIndex(),
+              snap.translation(), snap.position().y());
+      isotach_boundarylayer_speed *=
+          Physical::Constants::tenMeterToTopOfBoundaryLayer();
+      quad.setIsotachSpeedAtBoundaryLayer(isotach_boundarylayer_speed);
+      quad.setVmaxAtBoundaryLayer(snap.vmaxBoundaryLayer());
     }
   }
 }
 
-/**
- * Orders the isotachs by wind speed. This makes them
- * easier to work with later on.
- */
-void Preprocessor::orderIsotachs() {
-  for (auto &snap : m_atcf->data()) {
-    snap.orderIsotachs();
-  }
-}
-
-/**
- * Compute a prebuilt array for radii in each quadrant
- */
-void Preprocessor::processIsotachRadii() {
-  for (auto &snap : m_atcf->data()) {
-    snap.processIsotachRadii();
-  }
-}
-
 }  // namespace Gahm
@@ -21,27 +21,76 @@
 #ifndef GAHM_SRC_PREPROCESSOR_PREPROCESSOR_H_
 #define GAHM_SRC_PREPROCESSOR_PREPROCESSOR_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
 #include "atcf/AtcfFile.h"
 #include "atcf/AtcfIsotach.h"
 #include "atcf/AtcfQuadrant.h"
 #include "atcf/AtcfSnap.h"
 #include "atcf/StormTranslation.h"
+#include "preprocessor/SolutionCache.h"
+
+#ifdef SWIG
+#define NODISCARD
+#else
+#define NODISCARD [[nodiscard]]
+#endif
 
 namespace Gahm {
 class Preprocessor {
  public:
+  /**
+   * @brief Iteration counts from the most recent call to solve
+   */
+  struct t_solve_statistics {
+    size_t snaps{0};
+    size_t quadrants{0};
+    size_t outer_iterations{0};
+    size_t newton_iterations{0};
+    size_t warm_starts{0};
+    size_t cold_restarts{0};
+    size_t cache_hits{0};
+  };
+
   explicit Preprocessor(Gahm::Atcf::AtcfFile *atcf,
                         bool do_initialization = true);
 
   void prepareAtcfData();
   void solve();
+  void invalidate();
+
+  void setThreadCount(size_t thread_count);
+  NODISCARD auto threadCount() const -> size_t;
+
+  void setWarmStart(bool warm_start);
+  NODISCARD auto warmStart() const -> bool;
+
+  void setBatchSolve(bool batch_solve);
+  NODISCARD auto batchSolve() const -> bool;
+
+  void setSolutionCache(SolutionCache *cache);
+  NODISCARD auto solutionCache() const -> SolutionCache *;
+
+  NODISCARD auto solveStatistics() const -> const t_solve_statistics &;
 
  private:
-  void orderIsotachs();
-  void processIsotachRadii();
-  void fillMissingAtcfData();
-  void computeStormTranslationVelocities();
-  void computeBoundaryLayerWindspeed();
+  /**
+   * @brief Inputs of a snap when it was last prepared, and whether its
+   * quadrants have been solved since
+   */
+  struct t_snap_state {
+    std::vector<double> inputs;
+    bool solved;
+  };
+
+  NODISCARD auto snapInputs(size_t index) const -> std::vector<double>;
+  void prepareSnap(size_t index);
+  static void fillMissingAtcfData(Gahm::Atcf::AtcfSnap &snap);
+  void computeStormTranslationVelocity(size_t index);
+  static void computeBoundaryLayerWindspeed(Gahm::Atcf::AtcfSnap &snap);
   static auto getTranslation(const Gahm::Atcf::AtcfSnap &now,
                              const Gahm::Atcf::AtcfSnap &next)
       -> Gahm::Atcf::StormTranslation;
@@ -63,7 +112,13 @@ class Preprocessor {
   static auto countMissingIsotachRadii(Atcf::AtcfIsotach &isotach) -> long;
 
   Gahm::Atcf::AtcfFile *m_atcf{nullptr};
-  bool m_isotachsProcessed;
+  bool m_prepared{false};
+  std::unordered_map<int64_t, t_snap_state> m_snap_state;
+  size_t m_thread_count{1};
+  bool m_warm_start{false};
+  bool m_batch_solve{false};
+  SolutionCache *m_solution_cache{nullptr};
+  t_solve_statistics m_statistics;
 };
 }  // namespace Gahm
 #endif  // GAHM_SRC_PREPROCESSOR_PREPROCESSOR_H_
@@ -0,0 +1,295 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "SolutionCache.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "util/BinaryFile.h"
+#include "util/MappedFile.h"
+
+namespace Gahm {
+
+namespace {
+
+using Gahm::detail::BinaryFile::append;
+using Gahm::detail::BinaryFile::extract;
+using Gahm::detail::BinaryFile::fnv1a;
+
+constexpr std::array<char, 8> c_magic = {'G', 'A', 'H', 'M', 'S', 'O', 'L', 0};
+
+//...Written as a native integer so that a cache from a machine with the other
+// byte order is rejected
+constexpr uint32_t c_byte_order = 0x01020304;
+
+struct t_header {
+  std::array<char, 8> magic;
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t entry_count;
+  uint64_t checksum;
+};
+
+struct t_record {
+  double isotach_radius;
+  double isotach_speed;
+  double vmax;
+  double p_center;
+  double p_background;
+  double latitude;
+  double radius_tolerance;
+  uint64_t solver;
+  double rmax;
+  double gahm_b;
+};
+
+static_assert(sizeof(t_header) == 32);
+static_assert(sizeof(t_record) == 10 * sizeof(double));
+static_assert(std::is_trivially_copyable_v<t_header> &&
+              std::is_trivially_copyable_v<t_record>);
+static_assert(sizeof(SolutionCache::t_key) == 8 * sizeof(double));
+
+}  // namespace
+
+/**
+ * Constructor. Reads the cache file if it exists
+ * @param filename Name of the cache file
+ * @param capacity Maximum number of solutions to keep
+ */
+SolutionCache::SolutionCache(std::string filename, size_t capacity)
+    : m_filename(std::move(filename)), m_capacity(capacity) {
+  this->load();
+}
+
+/**
+ * Looks up the solution for a set of solver inputs. A hit marks the solution
+ * as the most recently used
+ * @param key Solver inputs
+ * @return Solution, or no value if the inputs have not been solved
+ */
+auto SolutionCache::find(const t_key &key) -> std::optional<t_solution> {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto it = m_index.find(key);
+  if (it == m_index.end()) {
+    m_misses++;
+    return {};
+  }
+  m_hits++;
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  return it->second->solution;
+}
+
+/**
+ * Adds or replaces the solution for a set of solver inputs. The least
+ * recently used solution is evicted if the cache is full
+ * @param key Solver inputs
+ * @param solution Solution
+ */
+void SolutionCache::insert(const t_key &key, const t_solution &solution) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_modified = true;
+  const auto it = m_index.find(key);
+  if (it != m_index.end()) {
+    it->second->solution = solution;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return;
+  }
+  m_entries.push_front({key, solution});
+  m_index.emplace(key, m_entries.begin());
+  this->evict();
+}
+
+/**
+ * Writes the cache file if any solutions have been added since it was read.
+ * Solutions in the file which are not in memory, because another process
+ * saved them, are kept as less recently used than any in memory
+ */
+void SolutionCache::save() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_modified) return;
+
+  for (auto &entry : SolutionCache::readEntries(m_filename)) {
+    if (m_entries.size() >= m_capacity) break;
+    if (m_index.count(entry.key) > 0) continue;
+    m_entries.push_back(entry);
+    m_index.emplace(entry.key, std::prev(m_entries.end()));
+  }
+
+  std::string records;
+  records.reserve(m_entries.size() * sizeof(t_record));
+  for (const auto &entry : m_entries) {
+    const auto &k = entry.key;
+    append(records, t_record{k.isotach_radius, k.isotach_speed, k.vmax,
+                             k.p_center, k.p_background, k.latitude,
+                             k.radius_tolerance, k.solver, entry.solution.rmax,
+                             entry.solution.gahm_b});
+  }
+
+  t_header header{};
+  header.magic = c_magic;
+  header.version = c_version;
+  header.byte_order = c_byte_order;
+  header.entry_count = m_entries.size();
+  header.checksum = fnv1a(records);
+
+  std::string contents;
+  contents.reserve(sizeof(header) + records.size());
+  append(contents, header);
+  contents += records;
+  Gahm::detail::BinaryFile::replace(m_filename, contents);
+  m_modified = false;
+}
+
+/**
+ * Returns the name of the cache file
+ * @return Filename
+ */
+auto SolutionCache::filename() const -> const std::string & {
+  return m_filename;
+}
+
+/**
+ * Returns the maximum number of solutions in the cache
+ * @return Capacity
+ */
+auto SolutionCache::capacity() const -> size_t { return m_capacity; }
+
+/**
+ * Returns the number of solutions in the cache
+ * @return Number of solutions
+ */
+auto SolutionCache::size() const -> size_t {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/**
+ * Returns the number of lookups which found a solution
+ * @return Number of hits
+ */
+auto SolutionCache::hits() const -> size_t {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_hits;
+}
+
+/**
+ * Returns the number of lookups which did not find a solution
+ * @return Number of misses
+ */
+auto SolutionCache::misses() const -> size_t {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_misses;
+}
+
+/**
+ * Reads the cache file into memory
+ */
+void SolutionCache::load() {
+  m_entries = SolutionCache::readEntries(m_filename);
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    if (m_index.emplace(it->key, it).second) {
+      ++it;
+    } else {
+      it = m_entries.erase(it);
+    }
+  }
+  this->evict();
+}
+
+/**
+ * Removes the least recently used solutions until the cache is within its
+ * capacity
+ */
+void SolutionCache::evict() {
+  while (m_entries.size() > m_capacity) {
+    m_index.erase(m_entries.back().key);
+    m_entries.pop_back();
+  }
+}
+
+/**
+ * Reads the solutions from a cache file
+ * @param filename Name of the cache file
+ * @return Solutions in the order of use, or no solutions if the file does not
+ * exist, is damaged or was written by another version
+ */
+auto SolutionCache::readEntries(const std::string &filename) -> t_entry_list {
+  std::error_code ec;
+  if (!std::filesystem::is_regular_file(filename, ec)) return {};
+
+  const Gahm::detail::MappedFile file(filename);
+  auto contents = file.view();
+  if (contents.size() < sizeof(t_header)) return {};
+
+  const auto header = extract<t_header>(contents);
+  if (header.magic != c_magic || header.version != c_version ||
+      header.byte_order != c_byte_order ||
+      header.entry_count != contents.size() / sizeof(t_record) ||
+      contents.size() % sizeof(t_record) != 0 ||
+      fnv1a(contents) != header.checksum) {
+    return {};
+  }
+
+  t_entry_list entries;
+  for (uint64_t i = 0; i < header.entry_count; ++i) {
+    const auto r = extract<t_record>(contents);
+    entries.push_back({{r.isotach_radius, r.isotach_speed, r.vmax, r.p_center,
+                        r.p_background, r.latitude, r.radius_tolerance,
+                        r.solver},
+                       {r.rmax, r.gahm_b}});
+  }
+  return entries;
+}
+
+/**
+ * Hashes the bytes of the solver inputs
+ * @param key Solver inputs
+ * @return Hash
+ */
+auto SolutionCache::t_key_hash::operator()(const t_key &key) const -> size_t {
+  return fnv1a(
+      std::string_view(reinterpret_cast<const char *>(&key), sizeof(t_key)));
+}
+
+/**
+ * Compares the bytes of the solver inputs, so inputs are only equal if they
+ * are identical
+ * @param a Solver inputs
+ * @param b Solver inputs
+ * @return True if the inputs are identical
+ */
+auto SolutionCache::t_key_equal::operator()(const t_key &a,
+                                            const t_key &b) const -> bool {
+  return std::memcmp(&a, &b, sizeof(t_key)) == 0;
+}
+
+}  // namespace Gahm
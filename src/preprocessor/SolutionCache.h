@@ -0,0 +1,148 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_PREPROCESSOR_SOLUTIONCACHE_H_
+#define GAHM_SRC_PREPROCESSOR_SOLUTIONCACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#ifdef SWIG
+#define NODISCARD
+#else
+#define NODISCARD [[nodiscard]]
+#endif
+
+namespace Gahm {
+
+/**
+ * @brief Persistent cache of GAHM solver results
+ *
+ * Maps the exact inputs of a quadrant solve to its radius to max winds and
+ * GAHM Holland B, so preprocessing a storm which has been solved before is a
+ * lookup. Inputs must match bit for bit to be a hit. The inputs include the
+ * configuration of the solver, since the solvers only agree to within their
+ * tolerance, so a solution is only returned to a solve made with the same
+ * configuration as the one that found it. The cache holds at most
+ * capacity() solutions and evicts the least recently used one when it is
+ * full. The order of use is saved with the cache, so it carries over between
+ * sessions.
+ *
+ * The cache is read when it is constructed and written by save(). The file is
+ * replaced as a whole by renaming a temporary file, so any number of processes
+ * can read it while another writes it. Before writing, the cache merges the
+ * solutions another process has saved in the meantime, ranking them below its
+ * own. A file which is damaged or was written by another version is ignored.
+ * A cache object can be shared between threads. The version is raised
+ * whenever the solver algorithm changes, so solutions found by an older
+ * solver are not used.
+ */
+class SolutionCache {
+ public:
+  static constexpr uint32_t c_version = 2;
+  static constexpr size_t c_default_capacity = 100000;
+
+  //...Flags of t_key::solver
+  static constexpr uint64_t c_solver_batch = 1;
+  static constexpr uint64_t c_solver_halley = 2;
+
+#ifndef SWIG
+  struct t_key {
+    double isotach_radius;
+    double isotach_speed;
+    double vmax;
+    double p_center;
+    double p_background;
+    double latitude;
+    double radius_tolerance;
+    uint64_t solver;
+  };
+
+  struct t_solution {
+    double rmax;
+    double gahm_b;
+  };
+#endif
+
+  explicit SolutionCache(std::string filename,
+                         size_t capacity = c_default_capacity);
+
+#ifndef SWIG
+  NODISCARD auto find(const t_key &key) -> std::optional<t_solution>;
+
+  void insert(const t_key &key, const t_solution &solution);
+#endif
+
+  void save();
+
+  void clear();
+
+  NODISCARD auto filename() const -> const std::string &;
+
+  NODISCARD auto capacity() const -> size_t;
+
+  NODISCARD auto size() const -> size_t;
+
+  NODISCARD auto hits() const -> size_t;
+
+  NODISCARD auto misses() const -> size_t;
+
+#ifndef SWIG
+ private:
+  struct t_entry {
+    t_key key;
+    t_solution solution;
+  };
+
+  struct t_key_hash {
+    auto operator()(const t_key &key) const -> size_t;
+  };
+
+  struct t_key_equal {
+    auto operator()(const t_key &a, const t_key &b) const -> bool;
+  };
+
+  using t_entry_list = std::list<t_entry>;
+
+  void load();
+  void evict();
+  static auto readEntries(const std::string &filename) -> t_entry_list;
+
+  std::string m_filename;
+  size_t m_capacity;
+  size_t m_hits{0};
+  size_t m_misses{0};
+  bool m_modified{false};
+
+  //...Most recently used first
+  t_entry_list m_entries;
+  std::unordered_map<t_key, t_entry_list::iterator, t_key_hash, t_key_equal>
+      m_index;
+  mutable std::mutex m_mutex;
+#endif
+};
+}  // namespace Gahm
+
+#endif  // GAHM_SRC_PREPROCESSOR_SOLUTIONCACHE_H_
@@ -36,11 +36,14 @@
 #include "output/OwiOutput.h"
 
 #include "preprocessor/Preprocessor.h"
+#include "preprocessor/SolutionCache.h"
 
+#include "vortex/PolarGrid.h"
 #include "vortex/Vortex.h"
 %}
 
 %include <std_string.i>
+%include <stdint.i>
 %include <exception.i>
 %include <std_vector.i>
 %include <windows.i>
@@ -63,6 +66,8 @@ namespace std {
     %template(SizetSizetVector) vector<vector<size_t>>;
     %template(AtcfSnapVector) vector<Gahm::Atcf::AtcfSnap>;
     %template(AtcfIsotachVector) vector<Gahm::Atcf::AtcfIsotach>;
+    %template(DateVector) vector<Gahm::Datatypes::Date>;
+    %template(VortexSolutionVector) vector<Gahm::Datatypes::VortexSolution>;
 }
 
 %include "gahm.h"
@@ -90,5 +95,7 @@ namespace std {
 %include "output/OwiOutput.h"
 
 %include "preprocessor/Preprocessor.h"
+%include "preprocessor/SolutionCache.h"
 
+%include "vortex/PolarGrid.h"
 %include "vortex/Vortex.h"
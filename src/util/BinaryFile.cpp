@@ -0,0 +1,85 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "BinaryFile.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+namespace Gahm::detail::BinaryFile {
+
+namespace {
+
+/**
+ * Returns a name for the temporary file a cache is written to before it is
+ * moved into place. Several processes may write the same cache at once, so
+ * the name must differ between them
+ * @param filename Name of the cache file
+ * @return Name of the temporary file
+ */
+auto temporaryFilename(const std::string &filename) -> std::string {
+  std::random_device device;
+  const auto token = (static_cast<uint64_t>(device()) << 32U) ^
+                     static_cast<uint64_t>(device()) ^
+                     std::hash<std::thread::id>()(std::this_thread::get_id());
+  return filename + ".tmp." + std::to_string(token);
+}
+
+}  // namespace
+
+/**
+ * Replaces the contents of a file. The contents are written under a temporary
+ * name and renamed over the file, so a reader sees either the old or the new
+ * contents
+ * @param filename Name of the file
+ * @param contents New contents of the file
+ */
+void replace(const std::string &filename, std::string_view contents) {
+  const auto temporary_filename = temporaryFilename(filename);
+  {
+    std::ofstream file(temporary_filename, std::ios::binary);
+    if (!file.is_open()) {
+      throw std::runtime_error("Unable to open file: " + temporary_filename);
+    }
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    file.close();
+    if (!file) {
+      std::filesystem::remove(temporary_filename);
+      throw std::runtime_error("Unable to write file: " + temporary_filename);
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(temporary_filename, filename, ec);
+  if (ec) {
+    std::filesystem::remove(temporary_filename);
+    throw std::runtime_error("Unable to write file: " + filename);
+  }
+}
+
+}  // namespace Gahm::detail::BinaryFile
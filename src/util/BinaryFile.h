@@ -0,0 +1,82 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_UTIL_BINARYFILE_H_
+#define GAHM_SRC_UTIL_BINARYFILE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Helpers for the binary cache files
+ *
+ * Cache files are native byte order records of trivially copyable structs.
+ * They are replaced as a whole by writing a temporary file and renaming it,
+ * so a process reading a cache never sees one which is partially written.
+ */
+namespace Gahm::detail::BinaryFile {
+
+/**
+ * 64 bit FNV-1a hash, used for checksums and to identify source files
+ * @param data Bytes to hash
+ * @param hash Hash of any preceding bytes
+ * @return Hash including data
+ */
+inline auto fnv1a(std::string_view data,
+                  uint64_t hash = 0xcbf29ce484222325ULL) -> uint64_t {
+  constexpr uint64_t prime = 0x100000001b3ULL;
+  for (const char c : data) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= prime;
+  }
+  return hash;
+}
+
+/**
+ * Appends the bytes of a value to a buffer
+ * @param buffer Buffer to append to
+ * @param value Value to append
+ */
+template <typename T>
+void append(std::string &buffer, const T &value) {
+  buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/**
+ * Reads a value from the front of a buffer and removes its bytes. The caller
+ * checks that the buffer is large enough
+ * @param buffer Buffer to read from
+ * @return Value
+ */
+template <typename T>
+auto extract(std::string_view &buffer) -> T {
+  T value;
+  std::memcpy(&value, buffer.data(), sizeof(T));
+  buffer.remove_prefix(sizeof(T));
+  return value;
+}
+
+void replace(const std::string &filename, std::string_view contents);
+
+}  // namespace Gahm::detail::BinaryFile
+
+#endif  // GAHM_SRC_UTIL_BINARYFILE_H_
@@ -23,6 +23,8 @@
 
 #include <cmath>
 
+#include "physical/Constants.h"
+
 namespace Gahm::Interpolation {
 
 /**
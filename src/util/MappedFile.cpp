@@ -0,0 +1,96 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "MappedFile.h"
+
+#include <cstddef>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Gahm::detail {
+
+/**
+ * Constructor
+ * @param filename Name of the file to map
+ */
+MappedFile::MappedFile(const std::string &filename) {
+#ifndef _WIN32
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Unable to open file: " + filename);
+  }
+
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Unable to open file: " + filename);
+  }
+
+  //...A zero length mapping is an error, so an empty file is left unmapped
+  m_size = static_cast<size_t>(file_stat.st_size);
+  if (m_size > 0) {
+    void *data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      ::madvise(data, m_size, MADV_SEQUENTIAL);
+      m_data = static_cast<const char *>(data);
+      m_mapped = true;
+    }
+  }
+  ::close(fd);
+  if (m_mapped || m_size == 0) return;
+#endif
+
+  //...Fall back to reading the whole file, for example when the file cannot
+  // be mapped
+  std::ifstream file(filename, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    throw std::runtime_error("Unable to open file: " + filename);
+  }
+  const std::streamsize file_size = file.tellg();
+  if (file_size < 0) {
+    throw std::runtime_error("Unable to read file: " + filename);
+  }
+  file.seekg(0, std::ios::beg);
+  m_buffer.resize(static_cast<size_t>(file_size));
+  if (!file.read(m_buffer.data(), file_size)) {
+    throw std::runtime_error("Unable to read file: " + filename);
+  }
+  m_data = m_buffer.data();
+  m_size = m_buffer.size();
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (m_mapped) {
+    ::munmap(const_cast<char *>(m_data), m_size);
+  }
+#endif
+}
+
+}  // namespace Gahm::detail
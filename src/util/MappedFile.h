@@ -0,0 +1,62 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_UTIL_MAPPEDFILE_H_
+#define GAHM_SRC_UTIL_MAPPEDFILE_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Gahm::detail {
+
+/**
+ * @brief Read-only view of the contents of a file
+ *
+ * On POSIX systems the file is memory mapped, so reading it does not copy the
+ * contents into a buffer. Elsewhere the file is read into memory once
+ */
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string &filename);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile(MappedFile &&) = delete;
+  auto operator=(const MappedFile &) -> MappedFile & = delete;
+  auto operator=(MappedFile &&) -> MappedFile & = delete;
+
+  [[nodiscard]] auto view() const -> std::string_view {
+    return {m_data, m_size};
+  }
+
+  [[nodiscard]] auto size() const -> size_t { return m_size; }
+
+ private:
+  const char *m_data{nullptr};
+  size_t m_size{0};
+  bool m_mapped{false};
+  std::string m_buffer;
+};
+
+}  // namespace Gahm::detail
+
+#endif  // GAHM_SRC_UTIL_MAPPEDFILE_H_
@@ -0,0 +1,103 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_UTIL_PARALLEL_H_
+#define GAHM_SRC_UTIL_PARALLEL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace Gahm::detail::Parallel {
+
+/**
+ * @brief Resolve the number of threads to use. A request of zero threads
+ * means "use all available hardware threads"
+ * @param requested_threads Number of threads requested by the user
+ * @return Number of threads to use (at least one)
+ */
+inline auto resolveThreadCount(size_t requested_threads) -> size_t {
+  if (requested_threads == 0) {
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+  return requested_threads;
+}
+
+/**
+ * @brief Run a function over the range [0, n_items) split into fixed size
+ * chunks. Chunk c is always processed by thread (c % n_threads), so the
+ * partitioning depends only on the inputs and never on scheduling. The
+ * function is called as function(chunk_begin, chunk_end).
+ *
+ * Any exception thrown by a worker is rethrown on the calling thread after
+ * all workers have been joined.
+ *
+ * @param n_items Number of items to process
+ * @param chunk_size Number of items in each chunk
+ * @param n_threads Number of threads to use
+ * @param function Function to call for each chunk
+ */
+template <typename Function>
+void parallelFor(size_t n_items, size_t chunk_size, size_t n_threads,
+                 const Function &function) {
+  if (n_items == 0) return;
+
+  chunk_size = std::max<size_t>(1, chunk_size);
+  const size_t n_chunks = (n_items + chunk_size - 1) / chunk_size;
+  n_threads = std::min(resolveThreadCount(n_threads), n_chunks);
+
+  if (n_threads <= 1) {
+    function(static_cast<size_t>(0), n_items);
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(n_threads);
+  const auto worker = [&](size_t thread_index) {
+    try {
+      for (size_t chunk = thread_index; chunk < n_chunks; chunk += n_threads) {
+        const size_t begin = chunk * chunk_size;
+        const size_t end = std::min(begin + chunk_size, n_items);
+        function(begin, end);
+      }
+    } catch (...) {
+      errors[thread_index] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(n_threads - 1);
+  for (size_t i = 1; i < n_threads; ++i) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+}  // namespace Gahm::detail::Parallel
+
+#endif  // GAHM_SRC_UTIL_PARALLEL_H_
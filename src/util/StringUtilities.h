@@ -21,29 +21,51 @@
 #ifndef GAHM_SRC_UTIL_STRINGUTILITIES_H_
 #define GAHM_SRC_UTIL_STRINGUTILITIES_H_
 
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
-#include <vector>
-
-#include "boost/algorithm/string/classification.hpp"
-#include "boost/algorithm/string/constants.hpp"
-#include "boost/algorithm/string/split.hpp"
-#include "boost/algorithm/string/trim.hpp"
 
 namespace Gahm::detail::Utilities {
 
 /**
- * @brief Split a string by commas
+ * @brief Remove leading and trailing whitespace from a string view
+ * @param s string to trim
+ * @return view of s without the surrounding whitespace
+ */
+inline auto trim(std::string_view s) -> std::string_view {
+  constexpr std::string_view whitespace = " \t\r\n";
+  const auto first = s.find_first_not_of(whitespace);
+  if (first == std::string_view::npos) return {};
+  const auto last = s.find_last_not_of(whitespace);
+  return s.substr(first, last - first + 1);
+}
+
+/**
+ * @brief Split a string by commas without copying. The views refer to the
+ * characters of string_value, so they are only valid while it is alive
+ * @tparam N Maximum number of fields to return
  * @param string_value string to split
- * @return vector of strings
+ * @param tokens array which receives the first N fields
+ * @return number of fields in the string, which may be larger than N
  */
-auto splitString(const std::string &string_value) -> std::vector<std::string> {
-  const auto sanitized_string =
-      boost::trim_copy_if(string_value, boost::is_any_of(" "));
-  std::vector<std::string> results;
-  boost::algorithm::split(results, sanitized_string, boost::is_any_of(","),
-                          boost::token_compress_off);
-  return results;
+template <size_t N>
+auto splitString(std::string_view string_value,
+                 std::array<std::string_view, N> &tokens) -> size_t {
+  string_value = trim(string_value);
+  size_t count = 0;
+  while (true) {
+    const auto comma = string_value.find(',');
+    if (count < N) tokens[count] = string_value.substr(0, comma);
+    count++;
+    if (comma == std::string_view::npos) break;
+    string_value.remove_prefix(comma + 1);
+  }
+  return count;
 }
 
 /**
@@ -54,22 +76,34 @@ auto splitString(const std::string &string_value) -> std::vector<std::string> {
  */
 template <typename T,
           typename = typename std::enable_if_t<std::is_fundamental_v<T>>>
-auto readValueCheckBlank(const std::string &s) -> T {
-  const auto s_copy = boost::trim_copy(s);
-  if (s_copy.empty()) {
-    return 0;
-  } else {
-    if (std::is_integral_v<T>) {
-      return stoi(s_copy);
-    } else if (std::is_floating_point_v<T>) {
-      return stod(s_copy);
-    } else if (std::is_same_v<bool, T>) {
-      auto i = stoi(s_copy);
-      return i != 0;
+auto readValueCheckBlank(std::string_view s) -> T {
+  s = trim(s);
+  if (s.empty()) return 0;
+  if (s.front() == '+') s.remove_prefix(1);
+
+  //...ATCF fields are integers, so floating point values are read as an
+  // integer first. std::from_chars for floating point types is not available
+  // on every supported standard library, so anything which is not a plain
+  // integer falls back to std::stod
+  long long value = 0;
+  const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+  if (ec != std::errc()) {
+    if constexpr (std::is_floating_point_v<T>) {
+      return static_cast<T>(std::stod(std::string(s)));
     } else {
-      // You should not be here
-      return 0;
+      throw std::invalid_argument("Invalid integer value: " + std::string(s));
+    }
+  }
+
+  if constexpr (std::is_same_v<bool, T>) {
+    return value != 0;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    if (ptr != s.data() + s.size()) {
+      return static_cast<T>(std::stod(std::string(s)));
     }
+    return static_cast<T>(value);
+  } else {
+    return static_cast<T>(value);
   }
 }
 }  // namespace Gahm::detail::Utilities
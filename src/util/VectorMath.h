@@ -0,0 +1,302 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_UTIL_VECTORMATH_H_
+#define GAHM_SRC_UTIL_VECTORMATH_H_
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+//...Compiles a function once for each instruction set and selects the version
+// to use at load time from the features of the running CPU. This relies on the
+// GNU ifunc mechanism, so it is only enabled for GCC on x86-64 Linux. Other
+// compilers get a single portable version of the function
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && \
+    defined(__linux__)
+#define GAHM_TARGET_CLONES \
+  __attribute__((target_clones("arch=x86-64-v4", "arch=x86-64-v3", "default")))
+#else
+#define GAHM_TARGET_CLONES
+#endif
+
+//...Helpers called from vectorized loops must be inlined into the loop or the
+// loop is not vectorized, which the inlining heuristics do not guarantee for
+// larger functions
+#if defined(__GNUC__)
+#define GAHM_FORCE_INLINE inline __attribute__((always_inline))
+#else
+#define GAHM_FORCE_INLINE inline
+#endif
+
+/**
+ * @brief Branch-free elementary functions for use in vectorized loops
+ *
+ * The routines are written as straight-line double precision arithmetic with
+ * selects instead of branches so that the compiler can inline them into a
+ * loop and vectorize it. They do not set errno or raise floating point
+ * exceptions for special values and only support the domains listed with each
+ * function. The error bounds were measured against the C++ standard library
+ * and are checked in the tests.
+ */
+namespace Gahm::VectorMath {
+
+namespace detail {
+
+//...Adding and subtracting this constant rounds a double to the nearest
+// integer and leaves the integer in the low bits of the representation
+constexpr double c_round_magic = 6755399441055744.0;  // 1.5 * 2^52
+
+inline auto toBits(double value) -> uint64_t {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+inline auto fromBits(uint64_t bits) -> double {
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+}  // namespace detail
+
+/**
+ * Computes e^x. The error is below 2 ulp for x in [-708, 709]. Results are
+ * zero below that range and saturate at e^709 above it
+ * @param x Exponent
+ * @return e^x
+ */
+inline auto exp(double x) -> double {
+  constexpr double log2e = 1.4426950408889634;
+  constexpr double ln2_hi = 6.93147180369123816490e-01;
+  constexpr double ln2_lo = 1.90821492927058770002e-10;
+
+  const double x_low = x < -708.0 ? -708.0 : x;
+  const double xc = x_low > 709.0 ? 709.0 : x_low;
+
+  //...x = n * ln(2) + r with |r| <= ln(2) / 2
+  const double kd = xc * log2e + detail::c_round_magic;
+  const double n = kd - detail::c_round_magic;
+  const double r = (xc - n * ln2_hi) - n * ln2_lo;
+
+  //...Taylor series of e^r through r^13. The truncation error is below 1e-17
+  double p = 1.0 / 6227020800.0;
+  p = p * r + 1.0 / 479001600.0;
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  //...Scale by 2^n, built directly from the exponent bits
+  const double scale = detail::fromBits((detail::toBits(kd) + 1023) << 52);
+  const double result = p * scale;
+  return x < -708.0 ? 0.0 : result;
+}
+
+/**
+ * Computes the natural logarithm of x. The error is below 2 ulp for positive,
+ * normal, finite x. Zero, negative, subnormal and non-finite inputs are not
+ * supported
+ * @param x Positive value
+ * @return ln(x)
+ */
+inline auto log(double x) -> double {
+  constexpr double ln2_hi = 6.93147180369123816490e-01;
+  constexpr double ln2_lo = 1.90821492927058770002e-10;
+  constexpr double sqrt2 = 1.4142135623730951;
+  constexpr uint64_t mantissa_mask = 0x000FFFFFFFFFFFFFULL;
+  constexpr uint64_t one_bits = 0x3FF0000000000000ULL;
+  constexpr uint64_t two52_bits = 0x4330000000000000ULL;
+  constexpr double two52 = 4503599627370496.0;
+
+  //...x = 2^e * m with m in [1, 2), then shifted to m in [sqrt(2)/2, sqrt(2))
+  const uint64_t bits = detail::toBits(x);
+  double e = detail::fromBits(two52_bits | (bits >> 52)) - two52 - 1023.0;
+  double m = detail::fromBits((bits & mantissa_mask) | one_bits);
+  const bool shift = m > sqrt2;
+  const double half_m = 0.5 * m;
+  const double e_plus_one = e + 1.0;
+  m = shift ? half_m : m;
+  e = shift ? e_plus_one : e;
+
+  //...ln(m) = 2 * atanh(s) with s = (m - 1) / (m + 1) and |s| < 0.172. The
+  // series is carried through s^23, where the truncation error is below 1e-18
+  const double f = m - 1.0;
+  const double s = f / (2.0 + f);
+  const double z = s * s;
+  double p = 2.0 / 23.0;
+  p = p * z + 2.0 / 21.0;
+  p = p * z + 2.0 / 19.0;
+  p = p * z + 2.0 / 17.0;
+  p = p * z + 2.0 / 15.0;
+  p = p * z + 2.0 / 13.0;
+  p = p * z + 2.0 / 11.0;
+  p = p * z + 2.0 / 9.0;
+  p = p * z + 2.0 / 7.0;
+  p = p * z + 2.0 / 5.0;
+  p = p * z + 2.0 / 3.0;
+
+  //...ln(m) = 2 * s + s * z * p and 2 * s = f - s * f, which lets the exact
+  // leading term f be added last
+  const double log_m = f - s * (f - z * p);
+  return e * ln2_hi + (e * ln2_lo + log_m);
+}
+
+/**
+ * Computes x^y for positive x as e^(y * ln(x)). The error is below
+ * 2 * (1 + |y * ln(x)|) ulp since the rounding errors of the logarithm and the
+ * product are magnified by the exponential. This is a few ulp for the
+ * arguments used by the vortex kernel
+ * @param x Positive base
+ * @param y Exponent
+ * @return x^y
+ */
+inline auto pow(double x, double y) -> double {
+  return VectorMath::exp(y * VectorMath::log(x));
+}
+
+/**
+ * Computes the sine and cosine of x together. The absolute error is below
+ * 2e-16 for |x| < 1e5, which covers all angles in radians used by the model
+ * @param x Angle in radians
+ * @param sin_x Sine of the angle
+ * @param cos_x Cosine of the angle
+ */
+inline void sincos(double x, double &sin_x, double &cos_x) {
+  constexpr double two_over_pi = 0.63661977236758134308;
+  constexpr double pio2_1 = 1.57079632673412561417e+00;
+  constexpr double pio2_2 = 6.07710050630396597660e-11;
+  constexpr double pio2_3 = 2.02226624871116645580e-21;
+
+  //...x = n * pi / 2 + r with |r| <= pi / 4
+  const double kd = x * two_over_pi + detail::c_round_magic;
+  const double n = kd - detail::c_round_magic;
+  const double r = ((x - n * pio2_1) - n * pio2_2) - n * pio2_3;
+  const uint64_t quadrant = detail::toBits(kd);
+  const double z = r * r;
+
+  //...Taylor series of sin(r) through r^17 and cos(r) through r^18
+  double ps = -1.0 / 355687428096000.0;
+  ps = ps * z + 1.0 / 1307674368000.0;
+  ps = ps * z - 1.0 / 6227020800.0;
+  ps = ps * z + 1.0 / 39916800.0;
+  ps = ps * z - 1.0 / 362880.0;
+  ps = ps * z + 1.0 / 5040.0;
+  ps = ps * z - 1.0 / 120.0;
+  ps = ps * z + 1.0 / 6.0;
+  const double s = r - r * z * ps;
+
+  double pc = 1.0 / 6402373705728000.0;
+  pc = pc * z - 1.0 / 20922789888000.0;
+  pc = pc * z + 1.0 / 87178291200.0;
+  pc = pc * z - 1.0 / 479001600.0;
+  pc = pc * z + 1.0 / 3628800.0;
+  pc = pc * z - 1.0 / 40320.0;
+  pc = pc * z + 1.0 / 720.0;
+  pc = pc * z - 1.0 / 24.0;
+  pc = pc * z + 0.5;
+  const double c = 1.0 - z * pc;
+
+  //...Rotate the result into the quadrant of x
+  const bool swap = (quadrant & 1U) != 0;
+  const bool negate_sin = (quadrant & 2U) != 0;
+  const bool negate_cos = ((quadrant + 1U) & 2U) != 0;
+  const double sin_r = swap ? c : s;
+  const double cos_r = swap ? s : c;
+  sin_x = negate_sin ? -sin_r : sin_r;
+  cos_x = negate_cos ? -cos_r : cos_r;
+}
+
+/**
+ * Computes the cosine of x. See sincos for the error bound
+ * @param x Angle in radians
+ * @return Cosine of the angle
+ */
+inline auto cos(double x) -> double {
+  double sin_x;
+  double cos_x;
+  VectorMath::sincos(x, sin_x, cos_x);
+  return cos_x;
+}
+
+/**
+ * Computes the angle of the point (x, y) in (-pi, pi]. The error is below
+ * 2 ulp. Unlike std::atan2, the signs of zero inputs are ignored, so
+ * atan2(0, 0) is 0 and atan2(0, x) is pi for negative x
+ * @param y y-coordinate
+ * @param x x-coordinate
+ * @return Angle in radians
+ */
+inline auto atan2(double y, double x) -> double {
+  constexpr double pi = 3.14159265358979323846;
+  constexpr double pio2 = 1.57079632679489661923;
+  constexpr double pio4 = 0.78539816339744830962;
+  constexpr double pio4_lo = 3.061616997868382943e-17;
+
+  //...Reduce to t = min / max in [0, 1]
+  const double ax = std::fabs(x);
+  const double ay = std::fabs(y);
+  const bool swap = ay > ax;
+  const double num = swap ? ax : ay;
+  const double den = swap ? ay : ax;
+  const double t = num / (den > 0.0 ? den : 1.0);
+
+  //...Reduce further to |u| <= 0.66 using atan(t) = pi / 4 + atan(u) with
+  // u = (t - 1) / (t + 1)
+  const bool shift = t > 0.66;
+  const double t_shifted = (t - 1.0) / (t + 1.0);
+  const double u = shift ? t_shifted : t;
+  const double base = shift ? pio4 : 0.0;
+  const double base_lo = shift ? pio4_lo : 0.0;
+
+  //...Rational approximation of atan(u) from the Cephes library
+  const double z = u * u;
+  double pn = -8.750608600031904122785e-01;
+  pn = pn * z - 1.615753718733365076637e+01;
+  pn = pn * z - 7.500855792314704667340e+01;
+  pn = pn * z - 1.228866684490136173410e+02;
+  pn = pn * z - 6.485021904942025371773e+01;
+  double pd = z + 2.485846490142306297962e+01;
+  pd = pd * z + 1.650270098316988542046e+02;
+  pd = pd * z + 4.328810604912902668951e+02;
+  pd = pd * z + 4.853903996359136964868e+02;
+  pd = pd * z + 1.945506571482613964425e+02;
+  double a = base + (u + (u * z * pn / pd + base_lo));
+
+  //...Undo the reductions
+  const double a_swapped = pio2 - a;
+  a = swap ? a_swapped : a;
+  const double a_reflected = pi - a;
+  a = x < 0.0 ? a_reflected : a;
+  return y < 0.0 ? -a : a;
+}
+
+}  // namespace Gahm::VectorMath
+
+#endif  // GAHM_SRC_UTIL_VECTORMATH_H_
@@ -0,0 +1,155 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+
+#include "PolarGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "datatypes/Uvp.h"
+#include "physical/Constants.h"
+#include "util/Interpolation.h"
+
+namespace Gahm {
+
+/**
+ * Default constructor. Creates an empty grid that contains no distances
+ */
+PolarGrid::PolarGrid()
+    : m_azimuth_count(0),
+      m_radius_count(0),
+      m_inner_radius(0.0),
+      m_outer_radius(-1.0),
+      m_log_inner_radius(0.0),
+      m_log_spacing(0.0),
+      m_azimuth_spacing(0.0) {}
+
+/**
+ * Constructor
+ * @param azimuth_count Number of nodes in azimuth
+ * @param radius_count Number of nodes in radius
+ * @param inner_radius Radius of the innermost ring of nodes in meters
+ * @param outer_radius Radius of the outermost ring of nodes in meters
+ */
+PolarGrid::PolarGrid(size_t azimuth_count, size_t radius_count,
+                     double inner_radius, double outer_radius)
+    : m_azimuth_count(azimuth_count),
+      m_radius_count(radius_count),
+      m_inner_radius(0.0),
+      m_outer_radius(-1.0),
+      m_log_inner_radius(0.0),
+      m_log_spacing(0.0),
+      m_azimuth_spacing(Physical::Constants::twoPi() /
+                        static_cast<double>(azimuth_count)),
+      m_radii(radius_count, 0.0),
+      m_u(azimuth_count * radius_count, 0.0),
+      m_v(azimuth_count * radius_count, 0.0),
+      m_p(azimuth_count * radius_count, 0.0) {
+  if (azimuth_count < 4) {
+    throw std::invalid_argument("Polar grid needs at least 4 azimuths");
+  }
+  if (radius_count < 2) {
+    throw std::invalid_argument("Polar grid needs at least 2 radii");
+  }
+  this->setRadii(inner_radius, outer_radius);
+}
+
+/**
+ * Moves the innermost and outermost rings of nodes. The node values are not
+ * changed and should be recomputed
+ * @param inner_radius Radius of the innermost ring of nodes in meters
+ * @param outer_radius Radius of the outermost ring of nodes in meters
+ */
+void PolarGrid::setRadii(double inner_radius, double outer_radius) {
+  if (inner_radius <= 0.0 || outer_radius <= inner_radius) {
+    throw std::invalid_argument(
+        "Polar grid radii must satisfy 0 < inner radius < outer radius");
+  }
+  m_inner_radius = inner_radius;
+  m_outer_radius = outer_radius;
+  m_log_inner_radius = std::log(inner_radius);
+  m_log_spacing = (std::log(outer_radius) - m_log_inner_radius) /
+                  static_cast<double>(m_radius_count - 1);
+
+  //...The outermost ring is placed at exactly the outer radius
+  for (size_t i = 0; i + 1 < m_radius_count; ++i) {
+    m_radii[i] =
+        std::exp(m_log_inner_radius + static_cast<double>(i) * m_log_spacing);
+  }
+  m_radii.back() = outer_radius;
+}
+
+/**
+ * Returns the azimuth of a spoke of nodes
+ * @param azimuth_index Index of the spoke
+ * @return Azimuth in radians
+ */
+auto PolarGrid::azimuth(size_t azimuth_index) const -> double {
+  return static_cast<double>(azimuth_index) * m_azimuth_spacing;
+}
+
+/**
+ * Interpolates the solution to a point. The distance must be within the grid
+ * (see contains)
+ * @param distance Distance from the storm center in meters
+ * @param azimuth Azimuth relative to the storm center in radians
+ * @return Interpolated wind and pressure
+ */
+auto PolarGrid::interpolate(double distance, double azimuth) const
+    -> Datatypes::Uvp {
+  //...Fractional ring index, kept inside the last cell so that the outer
+  // radius itself can be interpolated
+  const double s = (std::log(distance) - m_log_inner_radius) / m_log_spacing;
+  const double s_max = static_cast<double>(m_radius_count - 1);
+  const double s_clamped = s < 0.0 ? 0.0 : (s > s_max ? s_max : s);
+  const auto i0 = std::min(static_cast<size_t>(s_clamped), m_radius_count - 2);
+  const double w_r = s_clamped - static_cast<double>(i0);
+
+  //...Fractional spoke index, which wraps around at 2 pi
+  const double t = azimuth / m_azimuth_spacing;
+  const double t_floor = std::floor(t);
+  const double w_a = t - t_floor;
+  const auto n_azimuth = static_cast<int64_t>(m_azimuth_count);
+  const int64_t j_wrapped = static_cast<int64_t>(t_floor) % n_azimuth;
+  const auto j0 =
+      static_cast<size_t>(j_wrapped < 0 ? j_wrapped + n_azimuth : j_wrapped);
+  const size_t j1 = j0 + 1 == m_azimuth_count ? 0 : j0 + 1;
+
+  const size_t n00 = i0 * m_azimuth_count + j0;
+  const size_t n01 = i0 * m_azimuth_count + j1;
+  const size_t n10 = n00 + m_azimuth_count;
+  const size_t n11 = n01 + m_azimuth_count;
+
+  const auto bilinear = [&](const std::vector<double> &values) {
+    const double inner =
+        Interpolation::linear(values[n00], values[n01], w_a);
+    const double outer =
+        Interpolation::linear(values[n10], values[n11], w_a);
+    return Interpolation::linear(inner, outer, w_r);
+  };
+
+  return {bilinear(m_u), bilinear(m_v), bilinear(m_p)};
+}
+
+}  // namespace Gahm
@@ -0,0 +1,112 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_VORTEX_POLARGRID_H_
+#define GAHM_SRC_VORTEX_POLARGRID_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "datatypes/Uvp.h"
+
+#ifdef SWIG
+#define NODISCARD
+#else
+#define NODISCARD [[nodiscard]]
+#endif
+
+namespace Gahm {
+
+/**
+ * @brief Storm centered polar grid of vortex solutions
+ *
+ * The grid nodes are evenly spaced in azimuth, starting at zero, and
+ * logarithmically spaced in radius between the inner and outer radius. Values
+ * are interpolated bilinearly in (log(r), azimuth) and wrap around in azimuth.
+ * Nodes are numbered radius first, so node (i, j) is at radius index i and
+ * azimuth index j.
+ */
+class PolarGrid {
+ public:
+  PolarGrid();
+
+  PolarGrid(size_t azimuth_count, size_t radius_count, double inner_radius,
+            double outer_radius);
+
+  NODISCARD auto size() const -> size_t { return m_u.size(); }
+
+  NODISCARD auto azimuthCount() const -> size_t { return m_azimuth_count; }
+
+  NODISCARD auto radiusCount() const -> size_t { return m_radius_count; }
+
+  NODISCARD auto innerRadius() const -> double { return m_inner_radius; }
+
+  NODISCARD auto outerRadius() const -> double { return m_outer_radius; }
+
+  NODISCARD auto logInnerRadius() const -> double { return m_log_inner_radius; }
+
+  NODISCARD auto logSpacing() const -> double { return m_log_spacing; }
+
+  NODISCARD auto azimuthSpacing() const -> double { return m_azimuth_spacing; }
+
+  NODISCARD auto u() const -> const std::vector<double> & { return m_u; }
+
+  NODISCARD auto v() const -> const std::vector<double> & { return m_v; }
+
+  NODISCARD auto p() const -> const std::vector<double> & { return m_p; }
+
+  void setRadii(double inner_radius, double outer_radius);
+
+  NODISCARD auto radius(size_t radius_index) const -> double {
+    return m_radii[radius_index];
+  }
+
+  NODISCARD auto azimuth(size_t azimuth_index) const -> double;
+
+  NODISCARD auto contains(double distance) const -> bool {
+    return distance >= m_inner_radius && distance <= m_outer_radius;
+  }
+
+  void set(size_t node, const Datatypes::Uvp &uvp) {
+    m_u[node] = uvp.u();
+    m_v[node] = uvp.v();
+    m_p[node] = uvp.p();
+  }
+
+  NODISCARD auto interpolate(double distance, double azimuth) const
+      -> Datatypes::Uvp;
+
+ private:
+  size_t m_azimuth_count;
+  size_t m_radius_count;
+  double m_inner_radius;
+  double m_outer_radius;
+  double m_log_inner_radius;
+  double m_log_spacing;
+  double m_azimuth_spacing;
+  std::vector<double> m_radii;
+  std::vector<double> m_u;
+  std::vector<double> m_v;
+  std::vector<double> m_p;
+};
+
+}  // namespace Gahm
+
+#endif  // GAHM_SRC_VORTEX_POLARGRID_H_
@@ -22,21 +22,26 @@
 #include "Vortex.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
 #include <iterator>
+#include <limits>
+#include <stdexcept>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include "atcf/AtcfFile.h"
-#include "atcf/AtcfIsotach.h"
 #include "atcf/AtcfSnap.h"
+#include "atcf/CompiledTrack.h"
 #include "atcf/StormPosition.h"
 #include "atcf/StormTranslation.h"
 #include "datatypes/Date.h"
 #include "datatypes/Point.h"
 #include "datatypes/PointCloud.h"
+#include "datatypes/PointIndex.h"
 #include "datatypes/PointPosition.h"
 #include "datatypes/Uvp.h"
 #include "datatypes/VortexSolution.h"
@@ -44,17 +49,49 @@
 #include "physical/Constants.h"
 #include "physical/Earth.h"
 #include "util/Interpolation.h"
+#include "util/Parallel.h"
+#include "vortex/PolarGrid.h"
+#include "vortex/VortexKernelPrivate.h"
+
+//...Default number of points handed to a thread at a time
+constexpr size_t c_default_chunk_size = 4096;
 
 namespace Gahm {
 
 /**
- * Constructor for the Vortex class that takes an AtcfFile and a point cloud
+ * Constructor for the Vortex class that takes an AtcfFile and a point cloud.
+ * The track parameters are compiled into a flat table at construction, so the
+ * AtcfFile must already have been preprocessed. The table is compiled again
+ * when the revision of the AtcfFile changes, so the vortex stays valid when
+ * snaps are appended to the track and preprocessed, or changed through the
+ * non-const accessors of the AtcfFile. A reference to the snaps which is kept
+ * and used to change them after a solve needs AtcfFile::markModified() before
+ * the next solve
  *
  * @param atcfFile Pointer to the AtcfFile object
  * @param points Point cloud to be used for the vortex solution
  */
 Vortex::Vortex(const Atcf::AtcfFile *atcfFile, Datatypes::PointCloud points)
-    : m_atcfFile(atcfFile), m_points(std::move(points)) {}
+    : m_atcfFile(atcfFile),
+      m_track(*atcfFile),
+      m_time_index(m_track),
+      m_track_revision(atcfFile->revision()),
+      m_points(std::move(points)),
+      m_thread_count(1),
+      m_chunk_size(c_default_chunk_size),
+      m_use_geometry_cache(false),
+      m_use_batch_kernel(false),
+      m_use_bracket_cache(false),
+      m_cutoff_mode(CUTOFF_MODE::NONE),
+      m_cutoff_value(0.0),
+      m_cutoff_taper(0.0),
+      m_culled_point_count(0),
+      m_use_polar_grid(false),
+      m_polar_outer_radius(0.0),
+      m_forcing_interval(0),
+      m_blend_frame(BLEND_FRAME::MESH_FRAME),
+      m_forcing_levels{},
+      m_forcing_solve_count(0) {}
 
 /**
  * Solve the vortex for a given date
@@ -62,63 +99,1012 @@ Vortex::Vortex(const Atcf::AtcfFile *atcfFile, Datatypes::PointCloud points)
  * @return Vortex solution
  */
 auto Vortex::solve(const Datatypes::Date &date) -> Datatypes::VortexSolution {
-  //...Get the time iterator, next time iterator, and time weight. If the date
-  // is after the last time snap, then use the last time snap
-  auto sim_time = this->selectTime(date);
-  auto time_it = std::get<0>(sim_time);
-  auto time_weight = std::get<1>(sim_time);
+  Datatypes::VortexSolution solution;
+  this->solveInto(date, solution);
+  return solution;
+}
+
+/**
+ * Solve the vortex for a set of dates. The per-point geometry (see
+ * setUseGeometryCache) is computed once and shared by all of the dates, and
+ * the work is divided into (date, chunk of points) tasks so that both the
+ * dates and the points are spread across the threads. Every date is fully
+ * solved: the forcing interval (see setForcingInterval) only applies to single
+ * date solves and is ignored here, so nothing is blended and no polar grid is
+ * required for the storm frame. The results are identical to calling solve()
+ * for each date with the geometry cache enabled and no forcing interval. The
+ * culled point count is summed over all of the dates
+ * @param dates Dates to solve the vortex for
+ * @return Vortex solution for each date, in the order the dates were given
+ */
+auto Vortex::solve(const std::vector<Datatypes::Date> &dates)
+    -> std::vector<Datatypes::VortexSolution> {
+  this->refreshTrack();
+
+  const size_t n_points = m_points.size();
+  const size_t n_dates = dates.size();
+
+  std::vector<t_vortex_state> states;
+  states.reserve(n_dates);
+  for (const auto &date : dates) {
+    states.push_back(this->computeVortexState(date));
+  }
+
+  //...Each date gets its own copy of the polar grid
+  std::vector<PolarGrid> polar_grids(m_use_polar_grid ? n_dates : 0,
+                                     m_polar_grid);
+  for (size_t i = 0; i < polar_grids.size(); ++i) {
+    this->solvePolarGrid(states[i], polar_grids[i]);
+  }
+
+  std::vector<Datatypes::VortexSolution> solutions(n_dates);
+  for (auto &solution : solutions) {
+    solution.resize(n_points, Datatypes::Uvp());
+  }
+
+  //...Reuse the geometry cache if it exists, otherwise build it for the
+  // duration of this call
+  std::vector<t_point_geometry> local_geometry;
+  if (!m_use_geometry_cache) local_geometry = this->computePointGeometry();
+  const auto &geometry =
+      m_use_geometry_cache ? m_point_geometry : local_geometry;
+
+  //...Each date is split into the same chunks as a single solve so that a
+  // chunk never spans two dates
+  const size_t chunk_size = m_chunk_size;
+  const size_t chunks_per_date = (n_points + chunk_size - 1) / chunk_size;
+
+  std::atomic<size_t> culled_count{0};
+  Gahm::detail::Parallel::parallelFor(
+      n_dates * chunks_per_date, 1, m_thread_count,
+      [&](const size_t task_begin, const size_t task_end) {
+        size_t task_culled_count = 0;
+        for (size_t task = task_begin; task < task_end; ++task) {
+          const size_t date_index = task / chunks_per_date;
+          const size_t begin = (task % chunks_per_date) * chunk_size;
+          const size_t end = std::min(begin + chunk_size, n_points);
+          auto &solution = solutions[date_index];
+          task_culled_count += this->solveRange(
+              states[date_index], geometry.data(), nullptr, nullptr, begin,
+              end,
+              [&](const size_t index, const Datatypes::Uvp &uvp) {
+                solution.set(index, uvp);
+              });
+        }
+        culled_count += task_culled_count;
+      });
+  m_culled_point_count = culled_count.load();
+
+  return solutions;
+}
+
+/**
+ * Solve the vortex for a given date into an existing solution object. The
+ * solution is only resized when its size does not match the number of points,
+ * so reusing the same object across time steps avoids any allocation
+ * @param date Date to solve the vortex for
+ * @param solution Solution object to write into
+ */
+void Vortex::solveInto(const Datatypes::Date &date,
+                       Datatypes::VortexSolution &solution) {
+  if (solution.size() != m_points.size()) {
+    solution.resize(m_points.size(), Datatypes::Uvp());
+  }
+  this->solveDate(date, [&](const size_t index, const Datatypes::Uvp &uvp) {
+    solution.set(index, uvp);
+  });
+}
+
+/**
+ * Solve the vortex for a given date directly into caller owned arrays
+ * @param date Date to solve the vortex for
+ * @param u Array to write the u-component of the wind into
+ * @param v Array to write the v-component of the wind into
+ * @param p Array to write the pressure into
+ * @param size Size of the arrays. Must match the number of points
+ */
+void Vortex::solveInto(const Datatypes::Date &date, double *u, double *v,
+                       double *p, size_t size) {
+  if (size != m_points.size()) {
+    throw std::runtime_error(
+        "Size of the output arrays does not match the number of points");
+  }
+  this->solveDate(date, [&](const size_t index, const Datatypes::Uvp &uvp) {
+    u[index] = uvp.u();
+    v[index] = uvp.v();
+    p[index] = uvp.p();
+  });
+}
+
+/**
+ * Solves every point at a single date, either directly or by blending the
+ * solutions at the forcing times (see setForcingInterval)
+ * @param date Date to solve the vortex for
+ * @param setter Function called as setter(index, uvp) for each point
+ */
+template <typename Setter>
+void Vortex::solveDate(const Datatypes::Date &date, const Setter &setter) {
+  this->refreshTrack();
+  if (m_forcing_interval > 0) {
+    this->solveBlended(date, setter);
+    return;
+  }
+  auto state = this->computeVortexState(date);
+  if (m_use_polar_grid) this->solvePolarGrid(state, m_polar_grid);
+  m_culled_point_count = this->solvePoints(state, setter);
+}
+
+/**
+ * Serves a date from the forcing levels at the two forcing times that bracket
+ * it. A forcing level is only solved when the date moves into a new forcing
+ * interval, and when moving forward by one interval the later level is reused
+ * as the earlier one
+ * @param date Date to solve the vortex for
+ * @param setter Function called as setter(index, uvp) for each point
+ */
+template <typename Setter>
+void Vortex::solveBlended(const Datatypes::Date &date, const Setter &setter) {
+  if (m_blend_frame == BLEND_FRAME::STORM_FRAME && !m_use_polar_grid) {
+    throw std::runtime_error(
+        "Blending in the storm frame requires a polar grid");
+  }
+
+  //...Forcing times are whole multiples of the interval. Fractions of a
+  // second in the date are kept in the weight
+  const long long milliseconds =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          date.time_point().time_since_epoch())
+          .count();
+  const long long interval_ms = 1000LL * m_forcing_interval;
+  const long long level_index = milliseconds / interval_ms -
+                                (milliseconds % interval_ms < 0 ? 1 : 0);
+  const auto time0 = static_cast<long>(level_index * m_forcing_interval);
+  const long time1 = time0 + m_forcing_interval;
+  const double weight =
+      static_cast<double>(milliseconds - level_index * interval_ms) /
+      static_cast<double>(interval_ms);
+
+  auto &level0 = m_forcing_levels[0];
+  auto &level1 = m_forcing_levels[1];
+  if (!level0.valid || level0.time != time0) {
+    if (level1.valid && level1.time == time0) {
+      std::swap(level0, level1);
+    } else {
+      this->solveForcingLevel(time0, level0);
+    }
+  }
+  if (!level1.valid || level1.time != time1) {
+    this->solveForcingLevel(time1, level1);
+  }
+
+  //...In the storm frame, the polar grids of the two levels are blended at
+  // the position of each point relative to the storm at this date, so the
+  // storm moves between the levels instead of fading between them
+  if (m_blend_frame == BLEND_FRAME::STORM_FRAME) {
+    auto state = this->computeVortexState(date);
+    if (level0.has_polar_grid && level1.has_polar_grid) {
+      state.polar_grid = &level0.polar_grid;
+      state.polar_grid_next = &level1.polar_grid;
+      state.polar_weight = weight;
+    }
+    m_culled_point_count = this->solvePoints(state, setter);
+    return;
+  }
+
+  const auto &u0 = level0.solution.u();
+  const auto &v0 = level0.solution.v();
+  const auto &p0 = level0.solution.p();
+  const auto &u1 = level1.solution.u();
+  const auto &v1 = level1.solution.v();
+  const auto &p1 = level1.solution.p();
+  Gahm::detail::Parallel::parallelFor(
+      m_points.size(), m_chunk_size, m_thread_count,
+      [&](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          setter(i, Datatypes::Uvp(Interpolation::linear(u0[i], u1[i], weight),
+                                   Interpolation::linear(v0[i], v1[i], weight),
+                                   Interpolation::linear(p0[i], p1[i], weight)));
+        }
+      });
+  m_culled_point_count = weight < 0.5 ? level0.culled_point_count
+                                      : level1.culled_point_count;
+}
+
+/**
+ * Fully solves a forcing level. In the storm frame only the polar grid is
+ * solved, otherwise the solution at every point is stored
+ * @param time Forcing time in seconds since the epoch
+ * @param level Forcing level to fill
+ */
+void Vortex::solveForcingLevel(long time, Vortex::t_forcing_level &level) {
+  auto state = this->computeVortexState(Datatypes::Date(time));
+  level.time = time;
+  level.valid = true;
+  level.has_polar_grid = false;
+  level.culled_point_count = 0;
+  m_forcing_solve_count++;
+
+  if (m_use_polar_grid) {
+    level.polar_grid = m_polar_grid;
+    this->solvePolarGrid(state, level.polar_grid);
+    level.has_polar_grid = state.polar_grid != nullptr;
+  }
+  if (m_blend_frame == BLEND_FRAME::STORM_FRAME) return;
+
+  if (level.solution.size() != m_points.size()) {
+    level.solution.resize(m_points.size(), Datatypes::Uvp());
+  }
+  level.culled_point_count = this->solvePoints(
+      state, [&](const size_t index, const Datatypes::Uvp &uvp) {
+        level.solution.set(index, uvp);
+      });
+}
+
+/**
+ * Discards the stored forcing levels so that they are solved again with the
+ * current settings
+ */
+void Vortex::invalidateForcingLevels() {
+  for (auto &level : m_forcing_levels) {
+    level.valid = false;
+  }
+}
+
+/**
+ * Compiles the track again if the snaps of the AtcfFile have changed since it
+ * was last compiled. The stored forcing levels were solved from the old track
+ * and are discarded
+ */
+void Vortex::refreshTrack() {
+  if (m_atcfFile->revision() == m_track_revision) return;
+  m_track = Atcf::CompiledTrack(*m_atcfFile);
+  m_time_index = Atcf::TimeIndex(m_track);
+  m_track_revision = m_atcfFile->revision();
+  this->invalidateForcingLevels();
+}
+
+/**
+ * Solves every point in the point cloud and hands the result for each point
+ * to the setter. Each point is written to its own slot so that the result
+ * does not depend on the number of threads used
+ * @param state Vortex state at the current date
+ * @param setter Function called as setter(index, uvp) for each point
+ * @return Number of points beyond the cutoff radius
+ */
+template <typename Setter>
+auto Vortex::solvePoints(const Vortex::t_vortex_state &state,
+                         const Setter &setter) -> size_t {
+  const t_point_geometry *geometry =
+      m_use_geometry_cache ? m_point_geometry.data() : nullptr;
+  t_point_bracket *brackets =
+      m_use_bracket_cache ? m_point_bracket.data() : nullptr;
+
+  std::atomic<size_t> culled_count{0};
+
+  //...When there is a cutoff radius and the point cloud has a spatial index,
+  // only the points near the storm are solved. Everything else receives the
+  // background solution directly. The query wraps across the antimeridian, so
+  // the candidates hold every point the full scan would solve
+  if (std::isfinite(state.cutoff_radius) && m_points.hasIndex()) {
+    m_points.index()->queryRadiusBoundingBox(
+        state.current_storm_position.x(), state.current_storm_position.y(),
+        state.cutoff_radius, m_candidate_points);
+
+    const auto background = Vortex::backgroundSolution(state);
+    Gahm::detail::Parallel::parallelFor(
+        m_points.size(), m_chunk_size, m_thread_count,
+        [&](const size_t begin, const size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            setter(i, background);
+          }
+        });
+
+    Gahm::detail::Parallel::parallelFor(
+        m_candidate_points.size(), m_chunk_size, m_thread_count,
+        [&](const size_t begin, const size_t end) {
+          culled_count += this->solveRange(state, geometry, brackets,
+                                           m_candidate_points.data(), begin,
+                                           end, setter);
+        });
+
+    return culled_count.load() +
+           (m_points.size() - m_candidate_points.size());
+  }
+
+  Gahm::detail::Parallel::parallelFor(
+      m_points.size(), m_chunk_size, m_thread_count,
+      [&](const size_t begin, const size_t end) {
+        culled_count += this->solveRange(state, geometry, brackets, nullptr,
+                                         begin, end, setter);
+      });
+  return culled_count.load();
+}
 
-  if (time_it == m_atcfFile->data().end()) {
-    time_it = std::prev(time_it);
-    time_weight = 1.0;
+/**
+ * Solves the points in [begin, end) and hands the result for each point to
+ * the setter. Points are taken from the index list when one is given and are
+ * otherwise numbered directly
+ * @param state Vortex state at the current date
+ * @param geometry Cached geometry of every point, or nullptr to compute it
+ * from the point coordinates
+ * @param brackets Brackets kept for every point from the previous solve, or
+ * nullptr to search for them. Only used by the scalar path
+ * @param indices Indices of the points to solve, or nullptr
+ * @param begin First position to solve
+ * @param end One past the last position to solve
+ * @param setter Function called as setter(index, uvp) for each point
+ * @return Number of points beyond the cutoff radius
+ */
+template <typename Setter>
+auto Vortex::solveRange(const Vortex::t_vortex_state &state,
+                        const Vortex::t_point_geometry *geometry,
+                        Vortex::t_point_bracket *brackets,
+                        const size_t *indices, const size_t begin,
+                        const size_t end, const Setter &setter) const
+    -> size_t {
+  namespace kernel = Gahm::detail::VortexKernel;
+  const auto point_index = [&](const size_t k) {
+    return indices == nullptr ? k : indices[k];
+  };
+
+  //...Points covered by the polar grid are interpolated from it
+  const auto on_grid = [&](const double distance) {
+    return Vortex::onPolarGrid(state, distance);
+  };
+
+  size_t culled_count = 0;
+  if (!m_use_batch_kernel) {
+    for (size_t k = begin; k < end; ++k) {
+      const size_t i = point_index(k);
+      const auto [distance, azimuth] =
+          geometry != nullptr
+              ? Vortex::distanceAndAzimuth(state, geometry[i])
+              : Vortex::distanceAndAzimuth(state, m_points[i]);
+      t_point_bracket *bracket = brackets != nullptr ? &brackets[i] : nullptr;
+      setter(i, on_grid(distance)
+                    ? Vortex::interpolatePolarGrid(state, distance, azimuth)
+                    : Vortex::solveVortexPoint(state, distance, azimuth,
+                                               bracket));
+      if (distance >= state.cutoff_radius) culled_count++;
+    }
+    return culled_count;
   }
-  auto time_it_next = std::next(time_it);
-  if (time_it_next == m_atcfFile->data().end()) {
-    time_it_next = time_it;
+
+  const auto storm = Vortex::kernelStorm(state);
+  kernel::t_block block;
+  for (size_t block_begin = begin; block_begin < end;
+       block_begin += kernel::c_block_size) {
+    const size_t n = std::min(kernel::c_block_size, end - block_begin);
+
+    //...The padding lanes repeat the last point of the block
+    const size_t n_padded = (n + kernel::c_lane_padding - 1) /
+                            kernel::c_lane_padding * kernel::c_lane_padding;
+    if (geometry != nullptr) {
+      for (size_t k = 0; k < n_padded; ++k) {
+        const auto &g = geometry[point_index(block_begin + std::min(k, n - 1))];
+        block.sin_lat[k] = g.sin_lat;
+        block.cos_lat[k] = g.cos_lat;
+        block.sin_lon[k] = g.sin_lon;
+        block.cos_lon[k] = g.cos_lon;
+      }
+    } else {
+      for (size_t k = 0; k < n_padded; ++k) {
+        const auto &point =
+            m_points[point_index(block_begin + std::min(k, n - 1))];
+        block.x[k] = point.x();
+        block.y[k] = point.y();
+      }
+      kernel::pointGeometry(block, n_padded);
+    }
+
+    kernel::distanceAndAzimuth(storm, block, n_padded);
+
+    //...The full solution is only needed for points that are not covered by
+    // the polar grid
+    if (!std::all_of(block.distance, block.distance + n, on_grid)) {
+      kernel::parameters(storm, block, n_padded);
+      kernel::windAndPressure(storm, block, n_padded);
+    }
+    if (state.polar_grid != nullptr) {
+      kernel::interpolatePolarGrid(*state.polar_grid, state.polar_grid_next,
+                                   state.polar_weight, block, n_padded);
+    }
+
+    for (size_t k = 0; k < n; ++k) {
+      setter(point_index(block_begin + k),
+             Datatypes::Uvp(block.u[k], block.v[k], block.p[k]));
+      if (block.distance[k] >= state.cutoff_radius) culled_count++;
+    }
+  }
+  return culled_count;
+}
+
+/**
+ * Solves the vortex at the nodes of a polar grid centered on the storm and
+ * points the state at the grid. The grid is clipped to the cutoff radius
+ * since everything beyond it receives the background solution. If the cutoff
+ * radius is inside of the innermost ring, no grid is used
+ * @param state Vortex state at the current date
+ * @param grid Polar grid to solve
+ */
+void Vortex::solvePolarGrid(Vortex::t_vortex_state &state,
+                            PolarGrid &grid) const {
+  namespace kernel = Gahm::detail::VortexKernel;
+
+  state.polar_grid = nullptr;
+  const double outer_radius =
+      std::min(m_polar_outer_radius, state.cutoff_radius);
+  if (outer_radius <= grid.innerRadius()) return;
+  grid.setRadii(grid.innerRadius(), outer_radius);
+
+  //...The outermost ring is solved just inside of the cutoff radius so that a
+  // hard cutoff is not smeared across the last ring of cells
+  const double max_distance = std::nextafter(state.cutoff_radius, 0.0);
+  const size_t n_azimuth = grid.azimuthCount();
+  const auto node_distance = [&](const size_t node) {
+    return std::min(grid.radius(node / n_azimuth), max_distance);
+  };
+  const auto node_azimuth = [&](const size_t node) {
+    return grid.azimuth(node % n_azimuth);
+  };
+
+  Gahm::detail::Parallel::parallelFor(
+      grid.size(), m_chunk_size, m_thread_count,
+      [&](const size_t begin, const size_t end) {
+        if (!m_use_batch_kernel) {
+          for (size_t node = begin; node < end; ++node) {
+            grid.set(node,
+                     Vortex::solveVortexPoint(state, node_distance(node),
+                                              node_azimuth(node)));
+          }
+          return;
+        }
+
+        const auto storm = Vortex::kernelStorm(state);
+        kernel::t_block block;
+        for (size_t block_begin = begin; block_begin < end;
+             block_begin += kernel::c_block_size) {
+          const size_t n = std::min(kernel::c_block_size, end - block_begin);
+          const size_t n_padded = (n + kernel::c_lane_padding - 1) /
+                                  kernel::c_lane_padding *
+                                  kernel::c_lane_padding;
+          for (size_t k = 0; k < n_padded; ++k) {
+            const size_t node = block_begin + std::min(k, n - 1);
+            block.distance[k] = node_distance(node);
+            block.azimuth[k] = node_azimuth(node);
+          }
+          kernel::parameters(storm, block, n_padded);
+          kernel::windAndPressure(storm, block, n_padded);
+          for (size_t k = 0; k < n; ++k) {
+            grid.set(block_begin + k,
+                     Datatypes::Uvp(block.u[k], block.v[k], block.p[k]));
+          }
+        }
+      });
+
+  state.polar_grid = &grid;
+}
+
+/**
+ * Returns true if a point is covered by the polar grid, or by both polar
+ * grids when two are blended
+ * @param state Vortex state at the current date
+ * @param distance Distance from the storm center in meters
+ * @return True if the point is interpolated from the polar grid
+ */
+auto Vortex::onPolarGrid(const Vortex::t_vortex_state &state,
+                         const double distance) -> bool {
+  return state.polar_grid != nullptr && state.polar_grid->contains(distance) &&
+         (state.polar_grid_next == nullptr ||
+          state.polar_grid_next->contains(distance));
+}
+
+/**
+ * Interpolates the polar grid to a point. When two polar grids are blended,
+ * both are interpolated at the same position relative to the storm and then
+ * blended linearly
+ * @param state Vortex state at the current date
+ * @param distance Distance from the storm center in meters
+ * @param azimuth Azimuth relative to the storm center in radians
+ * @return Interpolated wind and pressure
+ */
+auto Vortex::interpolatePolarGrid(const Vortex::t_vortex_state &state,
+                                  const double distance, const double azimuth)
+    -> Datatypes::Uvp {
+  const auto uvp = state.polar_grid->interpolate(distance, azimuth);
+  if (state.polar_grid_next == nullptr) return uvp;
+  const auto uvp_next = state.polar_grid_next->interpolate(distance, azimuth);
+  return {Interpolation::linear(uvp.u(), uvp_next.u(), state.polar_weight),
+          Interpolation::linear(uvp.v(), uvp_next.v(), state.polar_weight),
+          Interpolation::linear(uvp.p(), uvp_next.p(), state.polar_weight)};
+}
+
+/**
+ * Returns the storm values used by the batch kernel
+ * @param state Vortex state at the current date
+ * @return Storm values for the batch kernel
+ */
+auto Vortex::kernelStorm(const Vortex::t_vortex_state &state)
+    -> Gahm::detail::VortexKernel::t_storm {
+  return {state.track,
+          state.snap,
+          state.snap_next,
+          state.time_weight,
+          state.storm_geometry.sin_lat,
+          state.storm_geometry.cos_lat,
+          state.storm_geometry.sin_lon,
+          state.storm_geometry.cos_lon,
+          state.current_storm_position.y(),
+          state.f_coriolis,
+          state.central_pressure,
+          state.background_pressure,
+          state.cutoff_radius,
+          state.taper_radius};
+}
+
+/**
+ * Returns the points that the vortex is solved at
+ * @return Point cloud
+ */
+auto Vortex::points() const -> const Datatypes::PointCloud & {
+  return m_points;
+}
+
+/**
+ * Sets the number of threads used to solve the vortex. A value of zero uses
+ * all available hardware threads
+ * @param thread_count Number of threads
+ */
+void Vortex::setThreadCount(size_t thread_count) {
+  m_thread_count = thread_count;
+}
+
+/**
+ * Returns the number of threads used to solve the vortex
+ * @return Number of threads
+ */
+auto Vortex::threadCount() const -> size_t { return m_thread_count; }
+
+/**
+ * Sets the number of points in each block of work handed to a thread
+ * @param chunk_size Number of points per chunk
+ */
+void Vortex::setChunkSize(size_t chunk_size) {
+  m_chunk_size = std::max<size_t>(1, chunk_size);
+}
+
+/**
+ * Returns the number of points in each block of work handed to a thread
+ * @return Number of points per chunk
+ */
+auto Vortex::chunkSize() const -> size_t { return m_chunk_size; }
+
+/**
+ * Enables or disables the per-point geometry cache. When enabled, the sines
+ * and cosines of each point's latitude and longitude are computed once and
+ * the distance and azimuth to the storm center are computed from them
+ * algebraically. The results agree with the uncached path to round-off
+ * @param use_geometry_cache True to enable the cache
+ */
+void Vortex::setUseGeometryCache(bool use_geometry_cache) {
+  this->invalidateForcingLevels();
+  m_use_geometry_cache = use_geometry_cache;
+  if (m_use_geometry_cache) {
+    m_point_geometry = this->computePointGeometry();
+  } else {
+    m_point_geometry.clear();
+    m_point_geometry.shrink_to_fit();
+  }
+}
+
+/**
+ * Enables or disables the per-point bracket cache. When enabled, the quadrant
+ * and isotach brackets found for each point are kept and checked first on the
+ * next solve. Between consecutive time steps the storm only moves a short
+ * distance, so most points stay in the same brackets and the search is
+ * replaced by a comparison against the two bounding radii. A point which has
+ * left its brackets is searched for again, so the results are bitwise
+ * identical to the uncached path. The cache is only used by the scalar path
+ * (see setUseBatchKernel) and not by the multiple date solve, where the dates
+ * are solved concurrently
+ * @param use_bracket_cache True to enable the cache
+ */
+void Vortex::setUseBracketCache(bool use_bracket_cache) {
+  m_use_bracket_cache = use_bracket_cache;
+  if (m_use_bracket_cache) {
+    m_point_bracket.assign(m_points.size(), t_point_bracket{});
+  } else {
+    m_point_bracket.clear();
+    m_point_bracket.shrink_to_fit();
+  }
+}
+
+/**
+ * Returns true if the per-point bracket cache is in use
+ * @return True if the bracket cache is enabled
+ */
+auto Vortex::useBracketCache() const -> bool { return m_use_bracket_cache; }
+
+/**
+ * Computes the sines and cosines of the latitude and longitude of every point
+ * @return Geometry of each point in the point cloud
+ */
+auto Vortex::computePointGeometry() const
+    -> std::vector<Vortex::t_point_geometry> {
+  std::vector<t_point_geometry> geometry(m_points.size());
+  Gahm::detail::Parallel::parallelFor(
+      m_points.size(), m_chunk_size, m_thread_count,
+      [&](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          geometry[i] = Vortex::pointGeometry(m_points[i].x(), m_points[i].y());
+        }
+      });
+  return geometry;
+}
+
+/**
+ * Enables or disables the batch kernel. The batch kernel solves blocks of
+ * points with vectorized, branch-free code that is compiled for several
+ * instruction sets and selected for the running CPU. When disabled, each point
+ * is solved with solveVortexPoint. The batch kernel evaluates the
+ * transcendental functions with the routines in util/VectorMath.h, so the two
+ * agree to round-off but not bitwise. It is disabled by default, so the
+ * results only change for callers which enable it
+ * @param use_batch_kernel True to enable the batch kernel
+ */
+void Vortex::setUseBatchKernel(bool use_batch_kernel) {
+  this->invalidateForcingLevels();
+  m_use_batch_kernel = use_batch_kernel;
+}
+
+/**
+ * Returns true if the batch kernel is in use
+ * @return True if the batch kernel is enabled
+ */
+auto Vortex::useBatchKernel() const -> bool { return m_use_batch_kernel; }
+
+/**
+ * Returns true if the per-point geometry cache is in use
+ * @return True if the geometry cache is enabled
+ */
+auto Vortex::useGeometryCache() const -> bool { return m_use_geometry_cache; }
+
+/**
+ * Sets an absolute cutoff radius. Points farther than the cutoff radius from
+ * the storm center are not solved and receive the background solution (no
+ * wind and background pressure). If the point cloud has a spatial index (see
+ * PointCloud::buildIndex), only the points near the storm are visited
+ * @param cutoff_radius Cutoff radius in meters
+ */
+void Vortex::setCutoffRadius(double cutoff_radius) {
+  if (cutoff_radius <= 0.0) {
+    throw std::invalid_argument("Cutoff radius must be positive");
+  }
+  this->invalidateForcingLevels();
+  m_cutoff_mode = CUTOFF_MODE::ABSOLUTE;
+  m_cutoff_value = cutoff_radius;
+}
+
+/**
+ * Sets the cutoff radius as a multiple of the outermost isotach radius of the
+ * storm at the current time
+ * @param multiple Multiple of the outermost isotach radius
+ */
+void Vortex::setCutoffIsotachMultiple(double multiple) {
+  if (multiple <= 0.0) {
+    throw std::invalid_argument("Cutoff isotach multiple must be positive");
+  }
+  this->invalidateForcingLevels();
+  m_cutoff_mode = CUTOFF_MODE::ISOTACH_MULTIPLE;
+  m_cutoff_value = multiple;
+}
+
+/**
+ * Disables the cutoff radius so that all points are solved
+ */
+void Vortex::disableCutoff() {
+  this->invalidateForcingLevels();
+  m_cutoff_mode = CUTOFF_MODE::NONE;
+  m_cutoff_value = 0.0;
+}
+
+/**
+ * Returns the mode used to compute the cutoff radius
+ * @return Cutoff mode
+ */
+auto Vortex::cutoffMode() const -> Vortex::CUTOFF_MODE { return m_cutoff_mode; }
+
+/**
+ * Returns the cutoff radius in meters or the isotach multiple, depending on
+ * the cutoff mode
+ * @return Cutoff value
+ */
+auto Vortex::cutoffValue() const -> double { return m_cutoff_value; }
+
+/**
+ * Sets the fraction of the cutoff radius over which the solution is smoothly
+ * tapered to the background solution. A value of zero gives a hard cutoff
+ * @param taper_fraction Fraction of the cutoff radius, between 0 and 1
+ */
+void Vortex::setCutoffTaper(double taper_fraction) {
+  if (taper_fraction < 0.0 || taper_fraction > 1.0) {
+    throw std::invalid_argument("Cutoff taper must be between 0 and 1");
+  }
+  this->invalidateForcingLevels();
+  m_cutoff_taper = taper_fraction;
+}
+
+/**
+ * Returns the fraction of the cutoff radius used to taper the solution
+ * @return Taper fraction
+ */
+auto Vortex::cutoffTaper() const -> double { return m_cutoff_taper; }
+
+/**
+ * Returns the number of points that were beyond the cutoff radius during the
+ * most recent solve
+ * @return Number of culled points
+ */
+auto Vortex::culledPointCount() const -> size_t { return m_culled_point_count; }
+
+/**
+ * Enables the polar grid solve mode. Each solve first evaluates the vortex on
+ * a storm centered polar grid and then interpolates the grid to the points
+ * whose distance from the storm center is between the inner and outer radius,
+ * so the cost of the full evaluation scales with the size of the grid rather
+ * than the number of points. Points outside of the grid are solved exactly.
+ * The grid spacing is logarithmic in radius, which keeps the cells small near
+ * the radius of maximum winds.
+ *
+ * The interpolation error depends on the resolution. With 360 azimuths and
+ * 200 radii between 1 km and 1000 km, the root mean square error against the
+ * exact solution for Katrina (2005) is about 0.003 m/s in wind and 0.003 mb
+ * in pressure, and 99.9% of the points are within 0.01 m/s and 0.01 mb. The
+ * largest errors, about 1 m/s and 4 mb, are next to places where the exact
+ * solution itself jumps in radius. The accuracy is checked in the tests
+ * @param azimuth_count Number of grid nodes in azimuth
+ * @param radius_count Number of grid nodes in radius
+ * @param inner_radius Radius of the innermost ring of nodes in meters
+ * @param outer_radius Radius of the outermost ring of nodes in meters
+ */
+void Vortex::setPolarGrid(size_t azimuth_count, size_t radius_count,
+                          double inner_radius, double outer_radius) {
+  m_polar_grid =
+      PolarGrid(azimuth_count, radius_count, inner_radius, outer_radius);
+  m_polar_outer_radius = outer_radius;
+  m_use_polar_grid = true;
+  this->invalidateForcingLevels();
+}
+
+/**
+ * Enables the forcing interval mode for single date solves. The vortex is
+ * fully solved only at forcing times, which are whole multiples of the
+ * interval, and the two forcing levels that bracket the requested date are
+ * kept. Dates in between are served by blending the two levels linearly in
+ * time, so a coupled model that asks for the wind every time step only pays
+ * for a full solve once per interval.
+ *
+ * In the mesh frame, the solutions at each point are blended, which costs
+ * about as much as copying the solution. This smears the eye and the
+ * maximum winds between the two storm positions when the storm moves
+ * farther than its radius to maximum winds over the interval. In the storm
+ * frame, the polar grids of the two levels (see setPolarGrid) are blended at
+ * the position of each point relative to the storm at the requested date.
+ * The storm structure then moves with the track instead of fading between
+ * two positions, at the cost of interpolating two polar grids at every
+ * point. The multiple date solve is not affected
+ * @param interval Forcing interval in seconds
+ * @param frame Frame that the forcing levels are blended in
+ */
+void Vortex::setForcingInterval(int interval, Vortex::BLEND_FRAME frame) {
+  if (interval <= 0) {
+    throw std::invalid_argument("Forcing interval must be positive");
+  }
+  m_forcing_interval = interval;
+  m_blend_frame = frame;
+  this->invalidateForcingLevels();
+}
+
+/**
+ * Disables the forcing interval mode so that every date is fully solved
+ */
+void Vortex::disableForcingInterval() {
+  m_forcing_interval = 0;
+  m_blend_frame = BLEND_FRAME::MESH_FRAME;
+  for (auto &level : m_forcing_levels) {
+    level = t_forcing_level{};
+  }
+}
+
+/**
+ * Returns the forcing interval in seconds, or zero when every date is fully
+ * solved
+ * @return Forcing interval
+ */
+auto Vortex::forcingInterval() const -> int { return m_forcing_interval; }
+
+/**
+ * Returns the frame that the forcing levels are blended in
+ * @return Blend frame
+ */
+auto Vortex::blendFrame() const -> Vortex::BLEND_FRAME { return m_blend_frame; }
+
+/**
+ * Returns the number of forcing levels that have been fully solved since the
+ * vortex was created
+ * @return Number of forcing level solves
+ */
+auto Vortex::forcingSolveCount() const -> size_t {
+  return m_forcing_solve_count;
+}
+
+/**
+ * Disables the polar grid solve mode so that every point is solved exactly
+ */
+void Vortex::disablePolarGrid() {
+  this->invalidateForcingLevels();
+  m_use_polar_grid = false;
+  m_polar_outer_radius = 0.0;
+  m_polar_grid = PolarGrid();
+}
+
+/**
+ * Returns true if the polar grid solve mode is enabled
+ * @return True if the polar grid is in use
+ */
+auto Vortex::usePolarGrid() const -> bool { return m_use_polar_grid; }
+
+/**
+ * Returns the polar grid used by the most recent single date solve
+ * @return Polar grid
+ */
+auto Vortex::polarGrid() const -> const PolarGrid & { return m_polar_grid; }
+
+/**
+ * Computes the sines and cosines of the latitude and longitude of a point
+ * @param x Longitude in degrees
+ * @param y Latitude in degrees
+ * @return Point geometry
+ */
+auto Vortex::pointGeometry(double x, double y) -> Vortex::t_point_geometry {
+  constexpr double deg2rad = Physical::Constants::deg2rad();
+  const double lat = y * deg2rad;
+  const double lon = x * deg2rad;
+  return {std::sin(lat), std::cos(lat), std::sin(lon), std::cos(lon)};
+}
+
+/**
+ * Computes the storm state (position, translation, pressures and bracketing
+ * time snaps) shared by all points at the given date
+ * @param date Date to compute the state for
+ * @return Vortex state
+ */
+auto Vortex::computeVortexState(const Datatypes::Date &date)
+    -> Vortex::t_vortex_state {
+  //...Get the snap and time weight. Dates are usually requested in increasing
+  // order, which the time index resolves without searching. If the date is
+  // after the last time snap, then use the last time snap
+  size_t snap = 0;
+  double time_weight = 0.0;
+  std::tie(snap, time_weight) = m_time_index.find(date.toSeconds());
+  auto snap_next = snap + 1;
+  if (snap_next == m_track.snapCount()) {
+    snap_next = snap;
   }
 
   //...Interpolate the storm to the current position
   const auto current_storm_position = Gahm::Atcf::StormPosition::interpolate(
-      time_it->position(), std::next(time_it)->position(), time_weight);
+      m_track.position(snap), m_track.position(snap_next), time_weight);
   const auto current_storm_translation =
-      Gahm::Atcf::StormTranslation::interpolate(
-          time_it->translation(), std::next(time_it)->translation(),
-          time_weight);
+      Gahm::Atcf::StormTranslation::interpolate(m_track.translation(snap),
+                                                m_track.translation(snap_next),
+                                                time_weight);
   const auto background_pressure = Gahm::Interpolation::linear(
-      time_it->backgroundPressure(), std::next(time_it)->backgroundPressure(),
+      m_track.backgroundPressure(snap), m_track.backgroundPressure(snap_next),
       time_weight);
   const auto central_pressure = Gahm::Interpolation::linear(
-      time_it->centralPressure(), std::next(time_it)->centralPressure(),
+      m_track.centralPressure(snap), m_track.centralPressure(snap_next),
       time_weight);
 
-  //...Generate a solution object
-  Datatypes::VortexSolution solution;
-  solution.reserve(m_points.size());
-
-  const auto state = Vortex::t_vortex_state{
-      time_it,
-      time_it_next,
-      time_weight,
-      current_storm_position,
-      current_storm_translation,
-      background_pressure,
-      central_pressure,
-      Gahm::Physical::Earth::coriolis(current_storm_position.y()),
-      date};
-
-  for (const auto &point : m_points) {
-    solution.push_back(Gahm::Vortex::solveVortexPoint(state, point));
-  }
+  //...Cutoff radius for this time. For the isotach multiple, the larger of the
+  // two bracketing snaps is used so that the cutoff does not shrink in between
+  const auto cutoff_radius = [&]() {
+    switch (m_cutoff_mode) {
+      case CUTOFF_MODE::ABSOLUTE:
+        return m_cutoff_value;
+      case CUTOFF_MODE::ISOTACH_MULTIPLE:
+        return m_cutoff_value *
+               std::max(m_track.outermostIsotachRadius(snap),
+                        m_track.outermostIsotachRadius(snap_next));
+      default:
+        return std::numeric_limits<double>::infinity();
+    }
+  }();
+  const auto taper_radius = cutoff_radius * (1.0 - m_cutoff_taper);
 
-  return solution;
+  return {&m_track,
+          snap,
+          snap_next,
+          time_weight,
+          current_storm_position,
+          current_storm_translation,
+          background_pressure,
+          central_pressure,
+          Gahm::Physical::Earth::coriolis(current_storm_position.y()),
+          Vortex::pointGeometry(current_storm_position.x(),
+                                current_storm_position.y()),
+          cutoff_radius,
+          taper_radius,
+          nullptr,
+          nullptr,
+          0.0};
 }
 
-auto Vortex::solveVortexPoint(const Vortex::t_vortex_state &state,
-                              const Datatypes::Point &point) -> Datatypes::Uvp {
+/**
+ * Computes the distance and azimuth from the storm center to a point
+ * @param state Vortex state at the current date
+ * @param point Point to compute the distance and azimuth for
+ * @return Tuple of the distance in meters and azimuth in radians
+ */
+auto Vortex::distanceAndAzimuth(const Vortex::t_vortex_state &state,
+                                const Datatypes::Point &point)
+    -> std::tuple<double, double> {
   const double distance = Physical::Earth::distance(
       point.x(), point.y(), state.current_storm_position.point().x(),
       state.current_storm_position.point().y());
 
+  //...Get the azimuth of the point relative to the storm center
+  const double azimuth = Physical::Earth::azimuth(
+      point.x(), point.y(), state.current_storm_position.point().x(),
+      state.current_storm_position.point().y());
+
+  return {distance, azimuth};
+}
+
+/**
+ * Computes the distance and azimuth from the storm center to a point using
+ * its cached geometry
+ * @param state Vortex state at the current date
+ * @param geometry Sines and cosines of the point latitude and longitude
+ * @return Tuple of the distance in meters and azimuth in radians
+ */
+auto Vortex::distanceAndAzimuth(const Vortex::t_vortex_state &state,
+                                const Vortex::t_point_geometry &geometry)
+    -> std::tuple<double, double> {
+  const auto &storm = state.storm_geometry;
+  return Physical::Earth::distanceAndAzimuth(
+      geometry.sin_lat, geometry.cos_lat, geometry.sin_lon, geometry.cos_lon,
+      storm.sin_lat, storm.cos_lat, storm.sin_lon, storm.cos_lon);
+}
+
+/**
+ * Returns the solution used for points beyond the cutoff radius
+ * @param state Vortex state at the current date
+ * @return Calm winds at the background pressure
+ */
+auto Vortex::backgroundSolution(const Vortex::t_vortex_state &state)
+    -> Datatypes::Uvp {
+  return {0.0, 0.0, state.background_pressure / 100.0};
+}
+
+/**
+ * Solves the vortex at a point given by its position relative to the storm
+ * @param state Vortex state at the current date
+ * @param distance Distance from the storm center in meters
+ * @param azimuth Azimuth relative to the storm center in radians
+ * @param bracket Brackets of the point from the previous solve, which are
+ * updated, or nullptr to search for them
+ * @return Wind and pressure at the point
+ */
+auto Vortex::solveVortexPoint(const Vortex::t_vortex_state &state,
+                              const double distance, const double azimuth,
+                              Vortex::t_point_bracket *bracket)
+    -> Datatypes::Uvp {
+  //...Points beyond the cutoff radius receive the background solution
+  if (distance >= state.cutoff_radius) {
+    return Vortex::backgroundSolution(state);
+  }
+
   //...We won't solve for points that are within 1 km of the storm center
   constexpr double min_distance = 1.0;
 
@@ -127,48 +1113,61 @@ auto Vortex::solveVortexPoint(const Vortex::t_vortex_state &state,
     return {0.0, 0.0, state.central_pressure / 100.0};
   }
 
-  //...Get the azimuth of the point relative to the storm center
-  const double azimuth = Physical::Earth::azimuth(
-      point.x(), point.y(), state.current_storm_position.point().x(),
-      state.current_storm_position.point().y());
-
   //...Get the parameters for this point at this time
   const Vortex::t_parameter_pack pack =
-      Vortex::getInterpolatedPack(state, distance, azimuth);
+      Vortex::getInterpolatedPack(state, distance, azimuth, bracket);
 
-  //...Solve for the phi value
-  const auto phi = Gahm::Solver::GahmEquations::phi(
-      pack.vmax_at_boundary_layer, pack.radius_to_max_wind, pack.holland_b,
-      state.f_coriolis);
+  //...Solve for the gradient wind speed and the pressure together
+  const auto [wind_speed, pressure_pa] =
+      Gahm::Solver::GahmEquations::GahmWindSpeedAndPressure(
+          pack.radius_to_max_wind, pack.vmax_at_boundary_layer, distance,
+          state.f_coriolis, pack.holland_b, state.central_pressure,
+          state.background_pressure);
 
-  //...Solve for the wind vector
-  auto [uf, vf] =
-      Vortex::computeVortexWindVector(state, pack, distance, azimuth);
+  //...Move the wind speed to a 10m, 10 minute wind and orient it
+  constexpr double wind_scaling =
+      Physical::Constants::topOfBoundaryLayerToTenMeter() *
+      Physical::Constants::oneMinuteToTenMinuteWind();
+  const auto [uf, vf] = Vortex::windVector(
+      wind_speed * wind_scaling, azimuth,
+      Vortex::friction_angle(distance, pack.radius_to_max_wind_true),
+      state.current_storm_position.y());
+  const auto pressure = pressure_pa / 100.0;
 
-  //...Solve for the pressure value
-  const auto pressure =
-      Gahm::Solver::GahmEquations::GahmPressure(
-          state.central_pressure, state.background_pressure, distance,
-          pack.radius_to_max_wind, pack.holland_b, phi) /
-      100.0;
+  //...Smoothly blend toward the background solution approaching the cutoff
+  if (distance > state.taper_radius) {
+    const double t = (distance - state.taper_radius) /
+                     (state.cutoff_radius - state.taper_radius);
+    const double weight =
+        0.5 * (1.0 + std::cos(Physical::Constants::pi() * t));
+    const auto background = Vortex::backgroundSolution(state);
+    return {uf * weight, vf * weight,
+            Interpolation::linear(background.p(), pressure, weight)};
+  }
 
   return {uf, vf, pressure};
 }
 
 auto Vortex::getInterpolatedPack(const Vortex::t_vortex_state &state,
-                                 const double distance, const double azimuth)
+                                 const double distance, const double azimuth,
+                                 Vortex::t_point_bracket *bracket)
     -> Vortex::t_parameter_pack {
-  //...Get the point position at two time points
-  const auto point_position_0 =
-      Vortex::getPointPosition(*state.time_it, distance, azimuth);
-  const auto point_position_1 =
-      Vortex::getPointPosition(*state.time_it_next, distance, azimuth);
+  //...The quadrant only depends on the azimuth, so it is shared by both time
+  // levels
+  const auto [base_quadrant, delta_angle] =
+      bracket == nullptr ? Vortex::getBaseQuadrant(azimuth)
+                         : Vortex::getBaseQuadrant(azimuth, bracket->quadrant);
+  if (bracket != nullptr) {
+    bracket->quadrant = static_cast<uint8_t>(base_quadrant);
+  }
 
   //...Interpolate parameter packs in space at two time points
-  const auto pack_t0 =
-      Vortex::getParameterPack(point_position_0, *state.time_it);
-  const auto pack_t1 =
-      Vortex::getParameterPack(point_position_1, *state.time_it_next);
+  const auto pack_t0 = Vortex::getParameterPack(
+      *state.track, state.snap, base_quadrant, delta_angle, distance,
+      bracket == nullptr ? nullptr : &bracket->isotach[0]);
+  const auto pack_t1 = Vortex::getParameterPack(
+      *state.track, state.snap_next, base_quadrant, delta_angle, distance,
+      bracket == nullptr ? nullptr : &bracket->isotach[1]);
 
   //...Interpolate the parameter packs in time
   const auto pack =
@@ -176,41 +1175,24 @@ auto Vortex::getInterpolatedPack(const Vortex::t_vortex_state &state,
   return pack;
 }
 
-auto Vortex::computeVortexWindVector(const Vortex::t_vortex_state &state,
-                                     const Vortex::t_parameter_pack &pack,
-                                     const double distance,
-                                     const double azimuth)
+/**
+ * Computes the u and v components of the wind from the wind speed. This is
+ * equivalent to decomposeWindVector followed by rotate_winds, but the two
+ * rotations are combined so that only one sine and cosine are needed
+ * @param wind_speed The wind speed
+ * @param azimuth The azimuth of the point relative to the storm center
+ * @param friction_angle The inflow angle in radians
+ * @param latitude The latitude of the storm
+ * @return Tuple containing the u and v components
+ */
+auto Vortex::windVector(double wind_speed, double azimuth,
+                        double friction_angle, double latitude)
     -> std::tuple<double, double> {
-  //...Solve for the wind speed
-  auto wind_speed = Solver::GahmEquations::GahmWindSpeed(
-      pack.radius_to_max_wind, pack.vmax_at_boundary_layer, distance,
-      state.f_coriolis, pack.holland_b);
-
-  //...Begin finalizing the wind speed by decomposing the wind vector, adding
-  // in the translation velocity, and rotating the winds
-  const auto [tsx, tsy] = Vortex::computeTranslationVelocityComponents(
-      wind_speed, pack.vmax_at_boundary_layer, state.current_storm_translation);
-
-  //...Move the wind speed back to 10m in height
-  wind_speed *= Physical::Constants::topOfBoundaryLayerToTenMeter();
-
-  //...Decompose the wind speed to its vector parts
-  const auto [u, v] = Vortex::decomposeWindVector(
-      wind_speed, azimuth, state.current_storm_position.y());
-
-  //...Rotate the winds
-  auto [uf, vf] = Vortex::rotate_winds(
-      u, v, friction_angle(distance, pack.radius_to_max_wind_true),
-      state.current_storm_position.y());
-
-  //...Add the translation speed back into the wind vector
-  //    uf += tsx;
-  //    vf += tsy;
-
-  uf *= Physical::Constants::oneMinuteToTenMinuteWind();
-  vf *= Physical::Constants::oneMinuteToTenMinuteWind();
-
-  return {uf, vf};
+  const double decompose_sign = (latitude < 0.0) ? -1.0 : 1.0;
+  const double rotate_sign = (latitude > 0.0) ? 1.0 : -1.0;
+  const double angle = azimuth - rotate_sign * friction_angle;
+  const double speed = decompose_sign * wind_speed;
+  return {-speed * std::cos(angle), speed * std::sin(angle)};
 }
 
 /**
@@ -265,26 +1247,9 @@ auto Vortex::computeTranslationVelocityComponents(
  */
 auto Vortex::selectTime(const Datatypes::Date &date) const
     -> std::tuple<std::vector<Atcf::AtcfSnap>::const_iterator, double> {
-  if (date <= m_atcfFile->data().front().date()) {
-    return {m_atcfFile->data().begin(), 0.0};
-  } else if (date >= m_atcfFile->data().back().date()) {
-    return {std::prev(m_atcfFile->data().end()), 1.0};
-  } else {
-    auto time_it = std::lower_bound(
-        m_atcfFile->data().begin(), m_atcfFile->data().end(), date,
-        [](const Atcf::AtcfSnap &lhs, const Datatypes::Date &rhs) {
-          return lhs.date() < rhs;
-        });
-
-    auto prev_time_it = std::prev(time_it);
-    const double time_weight =
-        static_cast<double>(date.toSeconds() -
-                            prev_time_it->date().toSeconds()) /
-        static_cast<double>(time_it->date().toSeconds() -
-                            prev_time_it->date().toSeconds());
-
-    return {prev_time_it, time_weight};
-  }
+  const auto [snap, time_weight] = m_time_index.search(date.toSeconds());
+  return {m_atcfFile->data().begin() + static_cast<std::ptrdiff_t>(snap),
+          time_weight};
 }
 
 /**
@@ -339,6 +1304,48 @@ auto Vortex::getBaseQuadrant(double angle) -> std::tuple<int, double> {
   return {base_quadrant, delta_angle};
 }
 
+/**
+ * Get the base quadrant for a given angle, checking the hinted quadrant first.
+ * The comparisons and the delta angle are the same as in getBaseQuadrant, so
+ * the result is always the same as the one without a hint
+ * @param angle Angle to get the base quadrant for in radians
+ * @param hint Quadrant returned by a previous call, usually for a nearby angle
+ * @return Base quadrant and remainder (delta angle) for the specified input
+ * angle
+ */
+auto Vortex::getBaseQuadrant(double angle, int hint)
+    -> std::tuple<int, double> {
+  constexpr double deg2rad = Physical::Constants::deg2rad();
+  constexpr double angle_45 = 45.0 * deg2rad;
+  constexpr double angle_135 = 135.0 * deg2rad;
+  constexpr double angle_225 = 225.0 * deg2rad;
+  constexpr double angle_315 = 315.0 * deg2rad;
+  switch (hint) {
+    case 0:
+      if (angle < angle_45) return {0, angle_45 + angle};
+      if (angle > angle_315) return {0, angle - angle_315};
+      break;
+    case 1:
+      if (angle >= angle_45 && angle <= angle_135) {
+        return {1, angle - angle_45};
+      }
+      break;
+    case 2:
+      if (angle > angle_135 && angle <= angle_225) {
+        return {2, angle - angle_135};
+      }
+      break;
+    case 3:
+      if (angle > angle_225 && angle <= angle_315) {
+        return {3, angle - angle_225};
+      }
+      break;
+    default:
+      break;
+  }
+  return Vortex::getBaseQuadrant(angle);
+}
+
 /**
  * Get the base isotach for a given distance and quadrant
  * @param distance Distance from the point to the storm center
@@ -349,7 +1356,7 @@ auto Vortex::getBaseQuadrant(double angle) -> std::tuple<int, double> {
 auto Vortex::getBaseIsotach(double distance, int quadrant,
                             const Atcf::AtcfSnap &snap)
     -> std::tuple<int, double> {
-  const auto radii = snap.radii()[quadrant];
+  const auto &radii = snap.radii()[quadrant];
 
   if (distance >= radii.back()) {
     return {snap.isotachCount() - 1, 1.0};
@@ -370,89 +1377,80 @@ auto Vortex::getBaseIsotach(double distance, int quadrant,
 }
 
 /**
- * Get the parameter pack for a given point position and time snap
- * @param point_position Point position to get the parameter pack for
- * @param snap Time snap 0 to get the parameter pack for
+ * Get the parameter pack for a given position relative to the storm center
+ * from the compiled track by interpolating between the isotachs and then
+ * between the base and adjacent quadrants
+ * @param track Compiled track to read the parameters from
+ * @param snap Snap index to get the parameter pack for
+ * @param quadrant Base quadrant of the point
+ * @param quadrant_weight Angle of the point within the base quadrant
+ * @param distance Distance from the point to the storm center
+ * @param isotach Isotach brackets of the adjacent and base quadrants from the
+ * previous solve, which are updated, or nullptr to search for them
  * @return Parameter pack object
  */
-auto Vortex::getParameterPack(
-    const Gahm::Datatypes::PointPosition &point_position,
-    const Atcf::AtcfSnap &snap) -> Vortex::t_parameter_pack {
-  return Vortex::interpolateParameterPackQuadrant(point_position, snap);
+auto Vortex::getParameterPack(const Atcf::CompiledTrack &track,
+                              const size_t snap, const int quadrant,
+                              const double quadrant_weight,
+                              const double distance,
+                              std::array<uint8_t, 2> *isotach)
+    -> Vortex::t_parameter_pack {
+  const auto pack0 = Vortex::interpolateParameterPackIsotach(
+      track, snap, quadrant - 1, distance,
+      isotach == nullptr ? nullptr : &(*isotach)[0]);
+  const auto pack1 = Vortex::interpolateParameterPackIsotach(
+      track, snap, quadrant, distance,
+      isotach == nullptr ? nullptr : &(*isotach)[1]);
+  return Vortex::interpolateParameterPackRadial(pack0, pack1, quadrant_weight);
 }
 
 /**
- * Helper function to convert an isotach into a parameter pack for a given
- * quadrant
- * @param isotach Isotach to convert
- * @param quadrant Quadrant to convert the isotach for
+ * Helper function to convert an entry in the compiled track into a parameter
+ * pack
+ * @param track Compiled track to read the parameters from
+ * @param index Flat index of the snap, quadrant and isotach in the track
  * @return Parameter pack object
  */
-auto Vortex::isotachToParameterPack(const Atcf::AtcfIsotach &isotach,
-                                    int quadrant) -> Vortex::t_parameter_pack {
-  const auto q = isotach.quadrant(quadrant);
-  return {q.radiusToMaxWindSpeed(), q.radiusToMaxWindSpeed(),
-          q.vmaxAtBoundaryLayer(), q.isotachSpeedAtBoundaryLayer(),
-          q.gahmHollandB()};
+auto Vortex::isotachToParameterPack(const Atcf::CompiledTrack &track,
+                                    const size_t index)
+    -> Vortex::t_parameter_pack {
+  return {track.radiusToMaxWinds(index), track.radiusToMaxWinds(index),
+          track.vmaxAtBoundaryLayer(index),
+          track.isotachSpeedAtBoundaryLayer(index), track.hollandB(index)};
 }
 
 /**
- * Get the parameter pack for a given point position and time snap
- * @param point_position Point position to get the parameter pack for
- * @param snap Time snap 0 to get the parameter pack for
- * @param time_index Time index to get the parameter pack for
- * @param quadrant_index Quadrant index to get the parameter pack for. Zero
- * denotes base quadrant, 1 denotes the next quadrant
+ * Get the parameter pack in a single quadrant by interpolating between the
+ * isotachs that bracket the distance
+ * @param track Compiled track to read the parameters from
+ * @param snap Snap index to get the parameter pack for
+ * @param quadrant Quadrant index to get the parameter pack for
+ * @param distance Distance from the point to the storm center
+ * @param hint Isotach bracket from the previous solve, which is updated, or
+ * nullptr to search for it
  * @return Parameter pack object
  */
-auto Vortex::interpolateParameterPackIsotach(
-    const Gahm::Datatypes::PointPosition &point_position,
-    const Atcf::AtcfSnap &snap, int quadrant_index)
+auto Vortex::interpolateParameterPackIsotach(const Atcf::CompiledTrack &track,
+                                             const size_t snap,
+                                             const int quadrant,
+                                             const double distance,
+                                             uint8_t *hint)
     -> Vortex::t_parameter_pack {
-  const auto [isotach, quadrant, weight] = [&]() {
-    if (quadrant_index == 0) {
-      return std::make_tuple(static_cast<size_t>(point_position.isotach()),
-                             point_position.quadrant() + quadrant_index,
-                             point_position.isotach_weight());
-    } else {
-      return std::make_tuple(
-          static_cast<size_t>(point_position.isotach_adjacent()),
-          point_position.quadrant() + quadrant_index,
-          point_position.isotach_adjacent_weight());
-    }
-  }();
+  const auto [isotach, weight] =
+      hint == nullptr ? track.isotachBracket(snap, quadrant, distance)
+                      : track.isotachBracket(snap, quadrant, distance, *hint);
+  if (hint != nullptr) *hint = static_cast<uint8_t>(isotach);
+  const auto index = track.index(snap, quadrant, isotach);
 
-  if (isotach == snap.isotachCount() - 1) {
-    return Vortex::isotachToParameterPack(snap.isotachs()[isotach], quadrant);
-  };
+  if (isotach == track.isotachCount(snap) - 1) {
+    return Vortex::isotachToParameterPack(track, index);
+  }
 
-  const auto i0 = snap.isotachs()[isotach];
-  const auto i1 = snap.isotachs()[isotach + 1];
-  const auto p0 = Vortex::isotachToParameterPack(i0, quadrant);
-  const auto p1 = Vortex::isotachToParameterPack(i1, quadrant);
+  const auto p0 = Vortex::isotachToParameterPack(track, index);
+  const auto p1 = Vortex::isotachToParameterPack(track, index + 1);
   return Vortex::interpolateParameterPack(p0, p1, weight);
 }
 
-/**
- * Interpolate the parameter pack for a given point position and time snap in
- * quadrant space
- * @param point_position Information about the point position relative to the
- * storm center
- * @param snap Time snap to interpolate the parameter pack for
- * @param time_index Time index to interpolate the parameter pack for
- * @return Parameter pack object
- */
-auto Vortex::interpolateParameterPackQuadrant(
-    const Gahm::Datatypes::PointPosition &point_position,
-    const Atcf::AtcfSnap &snap) -> Vortex::t_parameter_pack {
-  const auto pack0 =
-      Vortex::interpolateParameterPackIsotach(point_position, snap, -1);
-  const auto pack1 =
-      Vortex::interpolateParameterPackIsotach(point_position, snap, 0);
-  return Vortex::interpolateParameterPackRadial(
-      pack0, pack1, point_position.quadrant_weight());
-}
-
 /**
  * Interpolate a new parameter pack from two existing parameter packs and a
  * weighting factor
@@ -491,24 +1489,25 @@ auto Vortex::interpolateParameterPackRadial(
     const Vortex::t_parameter_pack &pack0,
     const Vortex::t_parameter_pack &pack1, double weight)
     -> Vortex::t_parameter_pack {
+  //...Inverse distance squared weighting on the angle, written in terms of
+  // the squared angles themselves so that it stays finite on the boundary
+  // between two quadrants
   constexpr double angle_90 = 90.0 * Physical::Constants::deg2rad();
-  const double nd0 = 1.0 / std::pow(weight, 2.0);
-  const double nd1 = 1.0 / std::pow(angle_90 - weight, 2.0);
-  const double den = 1.0 / (nd0 + nd1);
-
-  const double rmax =
-      (nd0 * pack0.radius_to_max_wind + nd1 * pack1.radius_to_max_wind) * den;
-  const double rmax_true = (nd0 * pack0.radius_to_max_wind_true +
-                            nd1 * pack1.radius_to_max_wind_true) *
-                           den;
-  const double vmax = (nd0 * pack0.vmax_at_boundary_layer +
-                       nd1 * pack1.vmax_at_boundary_layer) *
-                      den;
-  const double isotach_speed = (nd0 * pack0.isotach_speed_at_boundary_layer +
-                                nd1 * pack1.isotach_speed_at_boundary_layer) *
-                               den;
+  const double d0 = weight * weight;
+  const double d1 = (angle_90 - weight) * (angle_90 - weight);
+  const double w = d0 / (d0 + d1);
+
+  const double rmax = Interpolation::linear(pack0.radius_to_max_wind,
+                                            pack1.radius_to_max_wind, w);
+  const double rmax_true = Interpolation::linear(
+      pack0.radius_to_max_wind_true, pack1.radius_to_max_wind_true, w);
+  const double vmax = Interpolation::linear(pack0.vmax_at_boundary_layer,
+                                            pack1.vmax_at_boundary_layer, w);
+  const double isotach_speed =
+      Interpolation::linear(pack0.isotach_speed_at_boundary_layer,
+                            pack1.isotach_speed_at_boundary_layer, w);
   const double holland_b =
-      (nd0 * pack0.holland_b + nd1 * pack1.holland_b) * den;
+      Interpolation::linear(pack0.holland_b, pack1.holland_b, w);
   return {rmax, rmax_true, vmax, isotach_speed, holland_b};
 }
 
@@ -21,18 +21,23 @@
 #ifndef GAHM_VORTEX_H
 #define GAHM_VORTEX_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <tuple>
 #include <vector>
 
 #include "atcf/AtcfFile.h"
-#include "atcf/AtcfIsotach.h"
 #include "atcf/AtcfSnap.h"
+#include "atcf/CompiledTrack.h"
 #include "atcf/StormPosition.h"
 #include "atcf/StormTranslation.h"
+#include "atcf/TimeIndex.h"
 #include "datatypes/Date.h"
 #include "datatypes/PointCloud.h"
 #include "datatypes/PointPosition.h"
 #include "datatypes/VortexSolution.h"
+#include "vortex/PolarGrid.h"
 
 #ifdef SWIG
 #define NODISCARD
@@ -42,12 +47,73 @@
 
 namespace Gahm {
 
+namespace detail::VortexKernel {
+struct t_storm;
+}
+
 class Vortex {
  public:
+  enum CUTOFF_MODE { NONE, ABSOLUTE, ISOTACH_MULTIPLE };
+
+  enum BLEND_FRAME { MESH_FRAME, STORM_FRAME };
+
   Vortex(const Atcf::AtcfFile *atcfFile, Datatypes::PointCloud points);
 
   auto solve(const Gahm::Datatypes::Date &date) -> Datatypes::VortexSolution;
 
+  //...Fully solves every date. The forcing interval is not used
+  auto solve(const std::vector<Gahm::Datatypes::Date> &dates)
+      -> std::vector<Datatypes::VortexSolution>;
+
+  void solveInto(const Gahm::Datatypes::Date &date,
+                 Datatypes::VortexSolution &solution);
+
+#ifndef SWIG
+  void solveInto(const Gahm::Datatypes::Date &date, double *u, double *v,
+                 double *p, size_t size);
+#endif
+
+  NODISCARD auto points() const -> const Datatypes::PointCloud &;
+
+  void setThreadCount(size_t thread_count);
+  NODISCARD auto threadCount() const -> size_t;
+
+  void setChunkSize(size_t chunk_size);
+  NODISCARD auto chunkSize() const -> size_t;
+
+  void setUseGeometryCache(bool use_geometry_cache);
+  NODISCARD auto useGeometryCache() const -> bool;
+
+  void setUseBracketCache(bool use_bracket_cache);
+  NODISCARD auto useBracketCache() const -> bool;
+
+  void setUseBatchKernel(bool use_batch_kernel);
+  NODISCARD auto useBatchKernel() const -> bool;
+
+  void setCutoffRadius(double cutoff_radius);
+  void setCutoffIsotachMultiple(double multiple);
+  void disableCutoff();
+  NODISCARD auto cutoffMode() const -> Gahm::Vortex::CUTOFF_MODE;
+  NODISCARD auto cutoffValue() const -> double;
+
+  void setCutoffTaper(double taper_fraction);
+  NODISCARD auto cutoffTaper() const -> double;
+
+  NODISCARD auto culledPointCount() const -> size_t;
+
+  void setPolarGrid(size_t azimuth_count, size_t radius_count,
+                    double inner_radius, double outer_radius);
+  void disablePolarGrid();
+  NODISCARD auto usePolarGrid() const -> bool;
+  NODISCARD auto polarGrid() const -> const PolarGrid &;
+
+  void setForcingInterval(int interval,
+                          BLEND_FRAME frame = BLEND_FRAME::MESH_FRAME);
+  void disableForcingInterval();
+  NODISCARD auto forcingInterval() const -> int;
+  NODISCARD auto blendFrame() const -> Gahm::Vortex::BLEND_FRAME;
+  NODISCARD auto forcingSolveCount() const -> size_t;
+
   NODISCARD auto selectTime(const Datatypes::Date &date) const
       -> std::tuple<std::vector<Atcf::AtcfSnap>::const_iterator, double>;
 
@@ -57,6 +123,9 @@ class Vortex {
 
   static auto getBaseQuadrant(double angle) -> std::tuple<int, double>;
 
+  static auto getBaseQuadrant(double angle, int hint)
+      -> std::tuple<int, double>;
+
   static auto getBaseIsotach(double distance, int quadrant,
                              const Atcf::AtcfSnap &snap)
       -> std::tuple<int, double>;
@@ -71,6 +140,10 @@ class Vortex {
       double wind_speed, double vmax_at_boundary_layer,
       const Atcf::StormTranslation &translation) -> std::tuple<double, double>;
 
+  NODISCARD static auto windVector(double wind_speed, double azimuth,
+                                   double friction_angle, double latitude)
+      -> std::tuple<double, double>;
+
   NODISCARD static auto decomposeWindVector(double wind_speed, double azimuth,
                                             double latitude)
       -> std::tuple<double, double>;
@@ -84,45 +157,123 @@ class Vortex {
     double holland_b;
   };
 
+  struct t_point_geometry {
+    double sin_lat;
+    double cos_lat;
+    double sin_lon;
+    double cos_lon;
+  };
+
+  //...Quadrant and isotach brackets found for a point by the previous solve,
+  // indexed as [time level][quadrant - 1, quadrant]
+  struct t_point_bracket {
+    uint8_t quadrant;
+    std::array<std::array<uint8_t, 2>, 2> isotach;
+  };
+
   struct t_vortex_state {
-    std::vector<Atcf::AtcfSnap>::const_iterator time_it;
-    std::vector<Atcf::AtcfSnap>::const_iterator time_it_next;
+    const Atcf::CompiledTrack *track;
+    size_t snap;
+    size_t snap_next;
     double time_weight;
     Atcf::StormPosition current_storm_position;
     Atcf::StormTranslation current_storm_translation;
     double background_pressure;
     double central_pressure;
     double f_coriolis;
-    Datatypes::Date date;
+    t_point_geometry storm_geometry;
+    double cutoff_radius;
+    double taper_radius;
+    const PolarGrid *polar_grid;
+    const PolarGrid *polar_grid_next;
+    double polar_weight;
   };
 
-  static auto solveVortexPoint(const Vortex::t_vortex_state &state,
-                               const Datatypes::Point &point) -> Datatypes::Uvp;
+  struct t_forcing_level {
+    long time;
+    bool valid;
+    Datatypes::VortexSolution solution;
+    PolarGrid polar_grid;
+    bool has_polar_grid;
+    size_t culled_point_count;
+  };
+
+  NODISCARD auto computeVortexState(const Datatypes::Date &date)
+      -> t_vortex_state;
+
+  template <typename Setter>
+  void solveDate(const Datatypes::Date &date, const Setter &setter);
+
+  template <typename Setter>
+  void solveBlended(const Datatypes::Date &date, const Setter &setter);
+
+  void solveForcingLevel(long time, t_forcing_level &level);
+
+  void invalidateForcingLevels();
+
+  void refreshTrack();
+
+  template <typename Setter>
+  auto solvePoints(const t_vortex_state &state, const Setter &setter)
+      -> size_t;
+
+  template <typename Setter>
+  auto solveRange(const t_vortex_state &state,
+                  const t_point_geometry *geometry, t_point_bracket *brackets,
+                  const size_t *indices, size_t begin, size_t end,
+                  const Setter &setter) const -> size_t;
+
+  void solvePolarGrid(t_vortex_state &state, PolarGrid &grid) const;
+
+  static auto onPolarGrid(const t_vortex_state &state, double distance)
+      -> bool;
 
-  static auto computeVortexWindVector(const t_vortex_state &state,
-                                      const t_parameter_pack &pack,
-                                      const double distance,
-                                      const double azimuth)
+  static auto interpolatePolarGrid(const t_vortex_state &state,
+                                   double distance, double azimuth)
+      -> Datatypes::Uvp;
+
+  static auto kernelStorm(const t_vortex_state &state)
+      -> detail::VortexKernel::t_storm;
+
+  static auto distanceAndAzimuth(const Vortex::t_vortex_state &state,
+                                 const Datatypes::Point &point)
+      -> std::tuple<double, double>;
+
+  static auto distanceAndAzimuth(const Vortex::t_vortex_state &state,
+                                 const t_point_geometry &geometry)
       -> std::tuple<double, double>;
 
+  static auto solveVortexPoint(const Vortex::t_vortex_state &state,
+                               double distance, double azimuth,
+                               t_point_bracket *bracket = nullptr)
+      -> Datatypes::Uvp;
+
+  static auto backgroundSolution(const Vortex::t_vortex_state &state)
+      -> Datatypes::Uvp;
+
+  static auto pointGeometry(double x, double y) -> t_point_geometry;
+
+  NODISCARD auto computePointGeometry() const -> std::vector<t_point_geometry>;
+
   static auto getInterpolatedPack(const t_vortex_state &state,
-                                  const double distance, const double azimuth)
+                                  const double distance, const double azimuth,
+                                  t_point_bracket *bracket)
       -> t_parameter_pack;
 
-  static auto getParameterPack(
-      const Gahm::Datatypes::PointPosition &point_position,
-      const Atcf::AtcfSnap &snap) -> t_parameter_pack;
-
-  static auto isotachToParameterPack(const Atcf::AtcfIsotach &isotach,
-                                     int quadrant) -> t_parameter_pack;
+  static auto getParameterPack(const Atcf::CompiledTrack &track, size_t snap,
+                               int quadrant, double quadrant_weight,
+                               double distance,
+                               std::array<uint8_t, 2> *isotach)
+      -> t_parameter_pack;
 
-  static auto interpolateParameterPackIsotach(
-      const Gahm::Datatypes::PointPosition &point_position,
-      const Atcf::AtcfSnap &snap, int quadrant_index) -> t_parameter_pack;
+  static auto isotachToParameterPack(const Atcf::CompiledTrack &track,
+                                     size_t index) -> t_parameter_pack;
 
-  static auto interpolateParameterPackQuadrant(
-      const Gahm::Datatypes::PointPosition &point_position,
-      const Atcf::AtcfSnap &snap) -> t_parameter_pack;
+  static auto interpolateParameterPackIsotach(const Atcf::CompiledTrack &track,
+                                              size_t snap, int quadrant,
+                                              double distance,
+                                              uint8_t *hint)
+      -> t_parameter_pack;
 
   static auto interpolateParameterPack(const t_parameter_pack &pack0,
                                        const t_parameter_pack &pack1,
@@ -133,7 +284,29 @@ class Vortex {
       -> t_parameter_pack;
 
   const Atcf::AtcfFile *m_atcfFile;
+  Atcf::CompiledTrack m_track;
+  Atcf::TimeIndex m_time_index;
+  uint64_t m_track_revision;
   Datatypes::PointCloud m_points;
+  size_t m_thread_count;
+  size_t m_chunk_size;
+  bool m_use_geometry_cache;
+  bool m_use_batch_kernel;
+  std::vector<t_point_geometry> m_point_geometry;
+  bool m_use_bracket_cache;
+  std::vector<t_point_bracket> m_point_bracket;
+  CUTOFF_MODE m_cutoff_mode;
+  double m_cutoff_value;
+  double m_cutoff_taper;
+  size_t m_culled_point_count;
+  std::vector<size_t> m_candidate_points;
+  bool m_use_polar_grid;
+  double m_polar_outer_radius;
+  PolarGrid m_polar_grid;
+  int m_forcing_interval;
+  BLEND_FRAME m_blend_frame;
+  std::array<t_forcing_level, 2> m_forcing_levels;
+  size_t m_forcing_solve_count;
 };
 }  // namespace Gahm
 #endif  // GAHM_VORTEX_H
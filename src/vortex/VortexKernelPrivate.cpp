@@ -0,0 +1,463 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include "VortexKernelPrivate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "physical/Constants.h"
+#include "physical/Earth.h"
+#include "util/Interpolation.h"
+#include "util/VectorMath.h"
+#include "vortex/PolarGrid.h"
+
+namespace Gahm::detail::VortexKernel {
+
+/**
+ * Computes the sines and cosines of the latitude and longitude of the points
+ * in block.x and block.y
+ * @param block Block of points
+ * @param n Number of points in the block
+ */
+GAHM_TARGET_CLONES
+void pointGeometry(t_block &block, const size_t n) {
+  constexpr double deg2rad = Physical::Constants::deg2rad();
+#pragma omp simd
+  for (size_t k = 0; k < n; ++k) {
+    VectorMath::sincos(block.y[k] * deg2rad, block.sin_lat[k],
+                       block.cos_lat[k]);
+    VectorMath::sincos(block.x[k] * deg2rad, block.sin_lon[k],
+                       block.cos_lon[k]);
+  }
+}
+
+/**
+ * Computes the distance and azimuth from the storm center to each point. This
+ * is the same calculation as Earth::distanceAndAzimuth
+ * @param storm Storm values
+ * @param block Block of points
+ * @param n Number of points in the block
+ */
+GAHM_TARGET_CLONES
+void distanceAndAzimuth(const t_storm &storm, t_block &block, const size_t n) {
+  constexpr double two_pi = Physical::Constants::twoPi();
+#pragma omp simd
+  for (size_t k = 0; k < n; ++k) {
+    const double sin_dx =
+        storm.sin_lon * block.cos_lon[k] - storm.cos_lon * block.sin_lon[k];
+    const double cos_dx =
+        storm.cos_lon * block.cos_lon[k] + storm.sin_lon * block.sin_lon[k];
+
+    const double cos_c = block.sin_lat[k] * storm.sin_lat +
+                         block.cos_lat[k] * storm.cos_lat * cos_dx;
+    const double haversine = 0.5 * (1.0 - cos_c);
+    const double a_low = haversine < 0.0 ? 0.0 : haversine;
+    const double a = a_low > 1.0 ? 1.0 : a_low;
+    const double c =
+        2.0 * VectorMath::atan2(std::sqrt(a), std::sqrt(1.0 - a));
+
+    const double cos2_mean = 0.5 * (1.0 + block.cos_lat[k] * storm.cos_lat -
+                                    block.sin_lat[k] * storm.sin_lat);
+    block.distance[k] = Physical::Earth::radiusFromCosSquared(cos2_mean) * c;
+
+    const double ay = sin_dx * storm.cos_lat;
+    const double ax = block.cos_lat[k] * storm.sin_lat -
+                      block.sin_lat[k] * storm.cos_lat * cos_dx;
+    const double azimuth = VectorMath::atan2(-ay, -ax);
+    block.azimuth[k] = azimuth < 0.0 ? azimuth + two_pi : azimuth;
+  }
+}
+
+/**
+ * Interpolates the radius to max winds, max wind speed and Holland B for each
+ * point in space and time. The quadrant is selected arithmetically from the
+ * azimuth rather than with the comparisons in Vortex::getBaseQuadrant, and the
+ * isotachs that bracket the distance are found by counting the isotach radii
+ * below it. The work is split into passes so that the loop over the isotachs
+ * is outside of the vectorized loops over the points
+ * @param storm Storm values
+ * @param block Block of points
+ * @param n Number of points in the block
+ */
+GAHM_TARGET_CLONES
+void parameters(const t_storm &storm, t_block &block, const size_t n) {
+  constexpr double angle_45 = 45.0 * Physical::Constants::deg2rad();
+  constexpr double angle_90 = 90.0 * Physical::Constants::deg2rad();
+  const auto &track = *storm.track;
+  const size_t stride = track.maxIsotachCount();
+  const size_t snap_offset[2] = {storm.snap * 4 * stride,
+                                 storm.snap_next * 4 * stride};
+  const size_t isotach_count[4] = {
+      track.isotachCount(storm.snap), track.isotachCount(storm.snap),
+      track.isotachCount(storm.snap_next), track.isotachCount(storm.snap_next)};
+
+  //...Quadrant 0 covers [315, 45) degrees, so the azimuth is shifted by 45
+  // degrees before dividing into 90 degree sectors
+#pragma omp simd
+  for (size_t k = 0; k < n; ++k) {
+    const double shifted = block.azimuth[k] + angle_45;
+    const double sector = std::floor(shifted / angle_90);
+    block.delta_angle[k] = shifted - sector * angle_90;
+    const auto quadrant = static_cast<size_t>(static_cast<int>(sector) & 3);
+    const size_t previous_quadrant = (quadrant + 3) & 3U;
+    block.isotach_base[0][k] = snap_offset[0] + previous_quadrant * stride;
+    block.isotach_base[1][k] = snap_offset[0] + quadrant * stride;
+    block.isotach_base[2][k] = snap_offset[1] + previous_quadrant * stride;
+    block.isotach_base[3][k] = snap_offset[1] + quadrant * stride;
+  }
+
+  //...Number of isotach radii below the distance in each quadrant. The
+  // brackets are counted for every block rather than kept per point as in the
+  // scalar path (see Vortex::setUseBracketCache) since there are only a
+  // handful of isotachs and the count does not branch
+  for (size_t c = 0; c < 4; ++c) {
+    const size_t *base = block.isotach_base[c];
+    size_t *below = block.isotach_below[c];
+#pragma omp simd
+    for (size_t k = 0; k < n; ++k) {
+      below[k] = 0;
+    }
+    for (size_t i = 0; i < isotach_count[c]; ++i) {
+#pragma omp simd
+      for (size_t k = 0; k < n; ++k) {
+        below[k] += track.isotachRadius(base[k] + i) < block.distance[k]
+                        ? size_t{1}
+                        : size_t{0};
+      }
+    }
+  }
+
+  //...Interpolate between the isotachs in each quadrant. As in
+  // CompiledTrack::isotachBracket, the outermost and innermost isotachs are
+  // checked first and are used as is when the distance is outside of them
+  for (size_t c = 0; c < 4; ++c) {
+    const size_t count = isotach_count[c];
+    const size_t *base = block.isotach_base[c];
+    const size_t *below = block.isotach_below[c];
+#pragma omp simd
+    for (size_t k = 0; k < n; ++k) {
+      const double distance = block.distance[k];
+      const double r_first = track.isotachRadius(base[k]);
+      const double r_last = track.isotachRadius(base[k] + count - 1);
+
+      //...The selections are written as 0/1 integer arithmetic because
+      // compilers do not vectorize an integer select on a double comparison
+      const size_t inside = distance <= r_first ? 1 : 0;
+      const size_t beyond = distance >= r_last ? 1 : 0;
+      const size_t interior = 1 - (inside | beyond);
+      const size_t lower = below[k] < 1 ? 0 : below[k] - 1;
+      const size_t between = lower > count - 2 ? count - 2 : lower;
+      const size_t i0 = base[k] + interior * between + beyond * (count - 1);
+      const size_t i1 = i0 + interior;
+
+      const double r0 = track.isotachRadius(i0);
+      const double r1 = track.isotachRadius(i1);
+      double weight = (distance - r0) / (r1 - r0);
+      weight = distance <= r_first ? 0.0 : weight;
+      weight = distance >= r_last ? 0.0 : weight;
+
+      block.quadrant_rmax[c][k] =
+          Interpolation::linear(track.radiusToMaxWinds(i0),
+                                track.radiusToMaxWinds(i1), weight);
+      block.quadrant_vmax[c][k] =
+          Interpolation::linear(track.vmaxAtBoundaryLayer(i0),
+                                track.vmaxAtBoundaryLayer(i1), weight);
+      block.quadrant_holland_b[c][k] = Interpolation::linear(
+          track.hollandB(i0), track.hollandB(i1), weight);
+    }
+  }
+
+  //...Inverse distance weighting between the quadrants on the angle and then
+  // linear interpolation in time
+#pragma omp simd
+  for (size_t k = 0; k < n; ++k) {
+    const double remainder = angle_90 - block.delta_angle[k];
+    const double d0 = block.delta_angle[k] * block.delta_angle[k];
+    const double d1 = remainder * remainder;
+    const double w = d0 / (d0 + d1);
+
+    const double rmax0 = Interpolation::linear(block.quadrant_rmax[0][k],
+                                               block.quadrant_rmax[1][k], w);
+    const double rmax1 = Interpolation::linear(block.quadrant_rmax[2][k],
+                                               block.quadrant_rmax[3][k], w);
+    const double vmax0 = Interpolation::linear(block.quadrant_vmax[0][k],
+                                               block.quadrant_vmax[1][k], w);
+    const double vmax1 = Interpolation::linear(block.quadrant_vmax[2][k],
+                                               block.quadrant_vmax[3][k], w);
+    const double b0 = Interpolation::linear(block.quadrant_holland_b[0][k],
+                                            block.quadrant_holland_b[1][k], w);
+    const double b1 = Interpolation::linear(block.quadrant_holland_b[2][k],
+                                            block.quadrant_holland_b[3][k], w);
+
+    block.radius_to_max_wind[k] =
+        Interpolation::linear(rmax0, rmax1, storm.time_weight);
+    block.vmax_at_boundary_layer[k] =
+        Interpolation::linear(vmax0, vmax1, storm.time_weight);
+    block.holland_b[k] = Interpolation::linear(b0, b1, storm.time_weight);
+  }
+}
+
+/**
+ * Computes the wind and pressure at each point. This is the same calculation
+ * as Vortex::solveVortexPoint with the friction angle, the center and cutoff
+ * conditions and the taper applied as selects
+ * @param storm Storm values
+ * @param block Block of points
+ * @param n Number of points in the block
+ */
+GAHM_TARGET_CLONES
+void windAndPressure(const t_storm &storm, t_block &block, const size_t n) {
+  constexpr double deg2rad = Physical::Constants::deg2rad();
+  constexpr double angle_10 = 10.0 * deg2rad;
+  constexpr double angle_25 = 25.0 * deg2rad;
+  constexpr double angle_75 = 75.0 * deg2rad;
+  constexpr double min_distance = 1.0;
+  constexpr double wind_scaling =
+      Physical::Constants::topOfBoundaryLayerToTenMeter() *
+      Physical::Constants::oneMinuteToTenMinuteWind();
+
+  const double f = storm.f_coriolis;
+  const double half_f = 0.5 * f;
+  const double sign_of_coriolis = f >= 0.0 ? 1.0 : -1.0;
+  const double decompose_sign = storm.latitude < 0.0 ? -1.0 : 1.0;
+  const double rotate_sign = storm.latitude > 0.0 ? 1.0 : -1.0;
+  const double pressure_deficit =
+      storm.background_pressure - storm.central_pressure;
+  const double background_p = storm.background_pressure / 100.0;
+  const double central_p = storm.central_pressure / 100.0;
+  const double taper_scale =
+      Physical::Constants::pi() / (storm.cutoff_radius - storm.taper_radius);
+
+#pragma omp simd
+  for (size_t k = 0; k < n; ++k) {
+    const double distance = block.distance[k];
+    const double rmax = block.radius_to_max_wind[k];
+    const double vmax = block.vmax_at_boundary_layer[k];
+    const double holland_b = block.holland_b[k];
+
+    //...GAHM gradient wind speed and pressure
+    const double rossby = vmax / (f * rmax);
+    const double one_plus_inv_rossby = 1.0 + 1.0 / rossby;
+    const double phi =
+        1.0 + 1.0 / (rossby * holland_b * one_plus_inv_rossby);
+    const double rmbg = VectorMath::pow(rmax / distance, holland_b);
+    const double exp_pressure = VectorMath::exp(-phi * rmbg);
+    const double exp_wind = VectorMath::exp(phi) * exp_pressure;
+    const double half_fr = distance * half_f;
+    const double wind_speed =
+        sign_of_coriolis * std::sqrt(vmax * vmax * one_plus_inv_rossby *
+                                         exp_wind * rmbg +
+                                     half_fr * half_fr) -
+        half_fr;
+    const double pressure =
+        (storm.central_pressure + pressure_deficit * exp_pressure) / 100.0;
+
+    //...Friction angle, see Vortex::friction_angle
+    const double friction_ramp = angle_10 + angle_75 * (distance / rmax - 1.0);
+    const double friction =
+        distance < rmax ? angle_10
+                        : (distance < 1.2 * rmax ? friction_ramp : angle_25);
+
+    //...Decompose and rotate the wind, see Vortex::windVector
+    double sin_angle;
+    double cos_angle;
+    VectorMath::sincos(block.azimuth[k] - rotate_sign * friction, sin_angle,
+                       cos_angle);
+    const double speed = decompose_sign * wind_scaling * wind_speed;
+    double u = -speed * cos_angle;
+    double v = speed * sin_angle;
+    double p = pressure;
+
+    //...Taper toward the background solution approaching the cutoff
+    const double taper_weight =
+        0.5 * (1.0 + VectorMath::cos(taper_scale *
+                                     (distance - storm.taper_radius)));
+    const bool taper = distance > storm.taper_radius;
+    const double u_tapered = u * taper_weight;
+    const double v_tapered = v * taper_weight;
+    const double p_tapered =
+        Interpolation::linear(background_p, p, taper_weight);
+    u = taper ? u_tapered : u;
+    v = taper ? v_tapered : v;
+    p = taper ? p_tapered : p;
+
+    //...Storm center and points beyond the cutoff
+    const bool center = distance <= min_distance;
+    const bool culled = distance >= storm.cutoff_radius;
+    block.u[k] = center || culled ? 0.0 : u;
+    block.v[k] = center || culled ? 0.0 : v;
+    block.p[k] = culled ? background_p : (center ? central_p : p);
+  }
+}
+
+namespace {
+
+/**
+ * Grid values used by the polar grid interpolation, see PolarGrid
+ */
+struct t_polar_grid {
+  const double *u;
+  const double *v;
+  const double *p;
+  uint64_t n_azimuth;
+  double inner_radius;
+  double outer_radius;
+  double log_inner_radius;
+  double inverse_log_spacing;
+  double inverse_azimuth_spacing;
+  double s_max;
+  double i_max;
+};
+
+auto polarGridValues(const PolarGrid &grid) -> t_polar_grid {
+  return {grid.u().data(),
+          grid.v().data(),
+          grid.p().data(),
+          grid.azimuthCount(),
+          grid.innerRadius(),
+          grid.outerRadius(),
+          grid.logInnerRadius(),
+          1.0 / grid.logSpacing(),
+          1.0 / grid.azimuthSpacing(),
+          static_cast<double>(grid.radiusCount() - 1),
+          static_cast<double>(grid.radiusCount() - 2)};
+}
+
+/**
+ * Interpolates a polar grid to one point. This is the same calculation as
+ * PolarGrid::interpolate with the cell indices clamped so that points outside
+ * of the grid never read outside of it
+ * @param grid Polar grid values
+ * @param distance Distance from the storm center in meters
+ * @param azimuth Azimuth relative to the storm center in radians
+ * @param u Interpolated u-component of the wind
+ * @param v Interpolated v-component of the wind
+ * @param p Interpolated pressure
+ */
+GAHM_FORCE_INLINE void interpolatePoint(const t_polar_grid &grid,
+                                        const double distance,
+                                        const double azimuth, double &u,
+                                        double &v, double &p) {
+  constexpr uint64_t integer_mask = (uint64_t(1) << 51U) - 1U;
+
+  //...Fractional ring index. The comparisons are written so that a NaN from a
+  // point at the storm center is clamped to zero
+  const double s = (VectorMath::log(distance) - grid.log_inner_radius) *
+                   grid.inverse_log_spacing;
+  const double s_low = s >= 0.0 ? s : 0.0;
+  const double s_clamped = s_low < grid.s_max ? s_low : grid.s_max;
+  const double i_floor = std::floor(s_clamped);
+  const double i0 = i_floor < grid.i_max ? i_floor : grid.i_max;
+  const double w_r = s_clamped - i0;
+
+  //...Fractional spoke index, wrapped around at 2 pi
+  const double t = azimuth * grid.inverse_azimuth_spacing;
+  const double t_clamped = t >= 0.0 ? t : 0.0;
+  const double j_floor = std::floor(t_clamped);
+  const double w_a = t_clamped - j_floor;
+  const uint64_t j_raw =
+      VectorMath::detail::toBits(j_floor + VectorMath::detail::c_round_magic) &
+      integer_mask;
+  const uint64_t n_azimuth = grid.n_azimuth;
+  const uint64_t j0 =
+      j_raw - n_azimuth * static_cast<uint64_t>(j_raw >= n_azimuth);
+  const uint64_t j1 =
+      j0 + 1 - n_azimuth * static_cast<uint64_t>(j0 + 1 == n_azimuth);
+
+  const uint64_t row0 =
+      (VectorMath::detail::toBits(i0 + VectorMath::detail::c_round_magic) &
+       integer_mask) *
+      n_azimuth;
+  const uint64_t n00 = row0 + j0;
+  const uint64_t n01 = row0 + j1;
+  const uint64_t n10 = n00 + n_azimuth;
+  const uint64_t n11 = n01 + n_azimuth;
+
+  u = Interpolation::linear(
+      Interpolation::linear(grid.u[n00], grid.u[n01], w_a),
+      Interpolation::linear(grid.u[n10], grid.u[n11], w_a), w_r);
+  v = Interpolation::linear(
+      Interpolation::linear(grid.v[n00], grid.v[n01], w_a),
+      Interpolation::linear(grid.v[n10], grid.v[n11], w_a), w_r);
+  p = Interpolation::linear(
+      Interpolation::linear(grid.p[n00], grid.p[n01], w_a),
+      Interpolation::linear(grid.p[n10], grid.p[n11], w_a), w_r);
+}
+
+}  // namespace
+
+/**
+ * Replaces the solution at the points covered by a polar grid with values
+ * interpolated from the grid. When a second grid is given, the points must be
+ * covered by both grids and the two interpolated values are blended linearly
+ * @param grid Polar grid
+ * @param grid_next Second polar grid, or nullptr
+ * @param weight Weight of the second polar grid
+ * @param block Block of points
+ * @param n Number of points in the block
+ */
+GAHM_TARGET_CLONES
+void interpolatePolarGrid(const PolarGrid &grid, const PolarGrid *grid_next,
+                          const double weight, t_block &block,
+                          const size_t n) {
+  const auto g0 = polarGridValues(grid);
+
+  if (grid_next == nullptr) {
+#pragma omp simd
+    for (size_t k = 0; k < n; ++k) {
+      const double distance = block.distance[k];
+      double u;
+      double v;
+      double p;
+      interpolatePoint(g0, distance, block.azimuth[k], u, v, p);
+      const bool on_grid =
+          distance >= g0.inner_radius && distance <= g0.outer_radius;
+      block.u[k] = on_grid ? u : block.u[k];
+      block.v[k] = on_grid ? v : block.v[k];
+      block.p[k] = on_grid ? p : block.p[k];
+    }
+    return;
+  }
+
+  const auto g1 = polarGridValues(*grid_next);
+#pragma omp simd
+  for (size_t k = 0; k < n; ++k) {
+    const double distance = block.distance[k];
+    double u0;
+    double v0;
+    double p0;
+    double u1;
+    double v1;
+    double p1;
+    interpolatePoint(g0, distance, block.azimuth[k], u0, v0, p0);
+    interpolatePoint(g1, distance, block.azimuth[k], u1, v1, p1);
+    const bool on_grid =
+        distance >= g0.inner_radius && distance <= g0.outer_radius &&
+        distance >= g1.inner_radius && distance <= g1.outer_radius;
+    block.u[k] = on_grid ? Interpolation::linear(u0, u1, weight) : block.u[k];
+    block.v[k] = on_grid ? Interpolation::linear(v0, v1, weight) : block.v[k];
+    block.p[k] = on_grid ? Interpolation::linear(p0, p1, weight) : block.p[k];
+  }
+}
+
+}  // namespace Gahm::detail::VortexKernel
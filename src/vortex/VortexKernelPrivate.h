@@ -0,0 +1,112 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#ifndef GAHM_SRC_VORTEX_VORTEXKERNELPRIVATE_H_
+#define GAHM_SRC_VORTEX_VORTEXKERNELPRIVATE_H_
+
+#include <cstddef>
+
+#include "atcf/CompiledTrack.h"
+#include "vortex/PolarGrid.h"
+
+/**
+ * @brief Batch version of the per-point vortex solution
+ *
+ * Points are processed in blocks of up to c_block_size. Each stage reads and
+ * writes structure-of-arrays storage in a t_block and is a single loop with no
+ * data dependent branches, so the compiler vectorizes it. The stages are
+ * compiled for AVX-512, AVX2 and baseline x86-64 and the version matching the
+ * running CPU is selected when the library is loaded (see GAHM_TARGET_CLONES).
+ *
+ * The results agree with Vortex::solveVortexPoint to a few ulp in the
+ * transcendental functions, see util/VectorMath.h for the error bounds.
+ */
+namespace Gahm::detail::VortexKernel {
+
+constexpr size_t c_block_size = 64;
+
+//...Blocks are padded to a multiple of this many points, which is at least the
+// widest vector length. Every point is then computed in the vector body of the
+// loops and never in a scalar remainder loop, so the result for a point does
+// not depend on where it falls within a block
+constexpr size_t c_lane_padding = 8;
+
+/**
+ * @brief Storm values shared by every point in a solve
+ */
+struct t_storm {
+  const Atcf::CompiledTrack *track;
+  size_t snap;
+  size_t snap_next;
+  double time_weight;
+  double sin_lat;
+  double cos_lat;
+  double sin_lon;
+  double cos_lon;
+  double latitude;
+  double f_coriolis;
+  double central_pressure;
+  double background_pressure;
+  double cutoff_radius;
+  double taper_radius;
+};
+
+/**
+ * @brief Scratch storage for one block of points. The arrays with a leading
+ * dimension of 4 hold the previous and base quadrants at the current snap
+ * followed by the same quadrants at the next snap
+ */
+struct t_block {
+  alignas(64) double x[c_block_size];
+  alignas(64) double y[c_block_size];
+  alignas(64) double sin_lat[c_block_size];
+  alignas(64) double cos_lat[c_block_size];
+  alignas(64) double sin_lon[c_block_size];
+  alignas(64) double cos_lon[c_block_size];
+  alignas(64) double distance[c_block_size];
+  alignas(64) double azimuth[c_block_size];
+  alignas(64) double delta_angle[c_block_size];
+  alignas(64) size_t isotach_base[4][c_block_size];
+  alignas(64) size_t isotach_below[4][c_block_size];
+  alignas(64) double quadrant_rmax[4][c_block_size];
+  alignas(64) double quadrant_vmax[4][c_block_size];
+  alignas(64) double quadrant_holland_b[4][c_block_size];
+  alignas(64) double radius_to_max_wind[c_block_size];
+  alignas(64) double vmax_at_boundary_layer[c_block_size];
+  alignas(64) double holland_b[c_block_size];
+  alignas(64) double u[c_block_size];
+  alignas(64) double v[c_block_size];
+  alignas(64) double p[c_block_size];
+};
+
+void pointGeometry(t_block &block, size_t n);
+
+void distanceAndAzimuth(const t_storm &storm, t_block &block, size_t n);
+
+void parameters(const t_storm &storm, t_block &block, size_t n);
+
+void windAndPressure(const t_storm &storm, t_block &block, size_t n);
+
+void interpolatePolarGrid(const PolarGrid &grid, const PolarGrid *grid_next,
+                          double weight, t_block &block, size_t n);
+
+}  // namespace Gahm::detail::VortexKernel
+
+#endif  // GAHM_SRC_VORTEX_VORTEXKERNELPRIVATE_H_
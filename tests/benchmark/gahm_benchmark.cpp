@@ -19,15 +19,30 @@
 // Contact: zcobell@thewaterinstitute.org
 //
 
+#include <filesystem>
+#include <fstream>
 #include <random>
+#include <string>
 
+#include "atcf/AtcfCache.h"
 #include "atcf/AtcfFile.h"
 #include "benchmark/benchmark.h"
 #include "datatypes/Date.h"
 #include "datatypes/WindGrid.h"
 #include "preprocessor/Preprocessor.h"
+#include "preprocessor/SolutionCache.h"
 #include "vortex/Vortex.h"
 
+#ifdef GAHM_BENCHMARK_FORTRAN
+extern "C" {
+long gahm_create_ftn(char *filename, long size, double *x, double *y,
+                     bool quiet);
+void gahm_destroy_ftn(long id);
+void gahm_get_ftn(long id, int year, int month, int day, int hour, int minute,
+                  int second, long size, double *u, double *v, double *p);
+}
+#endif
+
 /*
  * Get a random time between two dates using a random number generator
  * @param mt Random number generator
@@ -43,12 +58,13 @@ Gahm::Datatypes::Date get_random_time(std::mt19937 &mt,
   auto time_diff = time_end_sec - time_start_sec;
   auto time_rand = time_start_sec + (mt() % time_diff);
   auto time_out = time_start;
-  time_out.addSeconds(time_rand);
+  time_out.addSeconds(time_rand - time_start_sec);
   return time_out;
 }
 
 /**
- * Benchmark the vortex solver for a random time
+ * Benchmark the vortex solver for a random time. The benchmark argument is
+ * the number of threads used by the solver
  * @param state Benchmark state
  */
 static void BM_Vortex(benchmark::State &state) {
@@ -70,6 +86,7 @@ static void BM_Vortex(benchmark::State &state) {
   auto wind_grid =
       Gahm::Datatypes::WindGrid::fromCorners(-100, 5, -70, 35, 0.1, 0.1);
   auto vortex = Gahm::Vortex(&atcf, wind_grid.points());
+  vortex.setThreadCount(static_cast<size_t>(state.range(0)));
 
   // Prep the counts of nodes processed and the time range
   size_t nodes_processed = 0;
@@ -86,12 +103,437 @@ static void BM_Vortex(benchmark::State &state) {
   }
 
   // Set the benchmark counters for nodes processed and rate
+  state.counters["NodeTime"] = benchmark::Counter(
+      static_cast<double>(nodes_processed), benchmark::Counter::kIsRate);
+  state.counters["NodeRate"] = benchmark::Counter(
+      static_cast<double>(nodes_processed),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+  state.counters["Threads"] = static_cast<double>(state.range(0));
+}
+
+/**
+ * Benchmark the vortex solver for a block of hourly dates solved in a single
+ * call. The benchmark argument is the number of dates in the block
+ * @param state Benchmark state
+ */
+static void BM_VortexMultipleDates(benchmark::State &state) {
+  std::string atcf_file = "../tests/test_files/bal122005.dat";
+  auto atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+  atcf.read();
+
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.prepareAtcfData();
+  preprocessor.solve();
+
+  auto wind_grid =
+      Gahm::Datatypes::WindGrid::fromCorners(-100, 5, -70, 35, 0.1, 0.1);
+  auto vortex = Gahm::Vortex(&atcf, wind_grid.points());
+
+  std::vector<Gahm::Datatypes::Date> dates;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    dates.push_back(atcf[0].date() + static_cast<int>(i * 3600));
+  }
+
+  size_t nodes_processed = 0;
+  for (auto _ : state) {
+    auto v = vortex.solve(dates);
+    benchmark::DoNotOptimize(v);
+    nodes_processed += wind_grid.points().size() * dates.size();
+  }
+
+  state.counters["NodeTime"] = benchmark::Counter(
+      static_cast<double>(nodes_processed), benchmark::Counter::kIsRate);
+  state.counters["NodeRate"] = benchmark::Counter(
+      static_cast<double>(nodes_processed),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * Benchmark the single threaded vortex solver with the scalar point loop and
+ * with the vectorized batch kernel. The benchmark argument is 1 to use the
+ * batch kernel and 0 to use the scalar loop
+ * @param state Benchmark state
+ */
+static void BM_VortexKernel(benchmark::State &state) {
+  std::mt19937 mt(
+      std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+  std::string atcf_file = "../tests/test_files/bal122005.dat";
+  auto atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+  atcf.read();
+
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.prepareAtcfData();
+  preprocessor.solve();
+
+  auto wind_grid =
+      Gahm::Datatypes::WindGrid::fromCorners(-100, 5, -70, 35, 0.1, 0.1);
+  auto vortex = Gahm::Vortex(&atcf, wind_grid.points());
+  vortex.setThreadCount(1);
+  vortex.setUseBatchKernel(state.range(0) != 0);
+
+  size_t nodes_processed = 0;
+  auto nodes_per_it = wind_grid.points().size();
+  auto time_start = atcf[0].date();
+  auto time_end = atcf[atcf.size() - 1].date();
+
+  for (auto _ : state) {
+    auto time = get_random_time(mt, time_start, time_end);
+    auto v = vortex.solve(time);
+    benchmark::DoNotOptimize(v);
+    nodes_processed += nodes_per_it;
+  }
+
+  state.counters["NodeTime"] = benchmark::Counter(
+      static_cast<double>(nodes_processed), benchmark::Counter::kIsRate);
+  state.counters["NodeRate"] = benchmark::Counter(
+      static_cast<double>(nodes_processed),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * Benchmark the polar grid solve mode on a fine wind grid. The benchmark
+ * argument is the number of radii in the polar grid, which has 360 azimuths
+ * and extends from 1 km to 4000 km so that it covers the whole wind grid. An
+ * argument of zero solves every point exactly
+ * @param state Benchmark state
+ */
+static void BM_VortexPolarGrid(benchmark::State &state) {
+  std::mt19937 mt(
+      std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+  std::string atcf_file = "../tests/test_files/bal122005.dat";
+  auto atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+  atcf.read();
+
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.prepareAtcfData();
+  preprocessor.solve();
+
+  auto wind_grid =
+      Gahm::Datatypes::WindGrid::fromCorners(-100, 5, -70, 35, 0.02, 0.02);
+  auto vortex = Gahm::Vortex(&atcf, wind_grid.points());
+  if (state.range(0) > 0) {
+    vortex.setPolarGrid(360, static_cast<size_t>(state.range(0)), 1000.0,
+                        4000.0e3);
+  }
+
+  size_t nodes_processed = 0;
+  auto nodes_per_it = wind_grid.points().size();
+  auto time_start = atcf[0].date();
+  auto time_end = atcf[atcf.size() - 1].date();
+
+  for (auto _ : state) {
+    auto time = get_random_time(mt, time_start, time_end);
+    auto v = vortex.solve(time);
+    benchmark::DoNotOptimize(v);
+    nodes_processed += nodes_per_it;
+  }
+
+  state.counters["NodeTime"] = benchmark::Counter(
+      static_cast<double>(nodes_processed), benchmark::Counter::kIsRate);
+  state.counters["NodeRate"] = benchmark::Counter(
+      static_cast<double>(nodes_processed),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * Benchmark for a coupled model time stepping loop, which calls the vortex at
+ * every model time step. The argument is the forcing interval in seconds,
+ * with zero solving every call exactly
+ * @param state Benchmark state
+ */
+static void BM_VortexForcingInterval(benchmark::State &state) {
+  std::string atcf_file = "../tests/test_files/bal122005.dat";
+  auto atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+  atcf.read();
+
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.prepareAtcfData();
+  preprocessor.solve();
+
+  auto wind_grid =
+      Gahm::Datatypes::WindGrid::fromCorners(-100, 5, -70, 35, 0.02, 0.02);
+  auto vortex = Gahm::Vortex(&atcf, wind_grid.points());
+  if (state.range(0) > 0) {
+    vortex.setForcingInterval(static_cast<int>(state.range(0)));
+  }
+
+  constexpr int time_step = 30;
+  Gahm::Datatypes::VortexSolution solution;
+  size_t nodes_processed = 0;
+  auto nodes_per_it = wind_grid.points().size();
+  auto time_start = atcf[0].date();
+  auto time = time_start;
+
+  for (auto _ : state) {
+    time.addSeconds(time_step);
+    if (time > atcf[atcf.size() - 1].date()) time = time_start;
+    vortex.solveInto(time, solution);
+    benchmark::DoNotOptimize(solution);
+    nodes_processed += nodes_per_it;
+  }
+
+  state.counters["NodeTime"] = benchmark::Counter(
+      static_cast<double>(nodes_processed), benchmark::Counter::kIsRate);
+  state.counters["NodeRate"] = benchmark::Counter(
+      static_cast<double>(nodes_processed),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * Benchmark the scalar point loop stepping through the track at a model time
+ * step, with and without the per-point bracket cache. The benchmark argument
+ * is 1 to keep the brackets between steps and 0 to search for them at every
+ * step
+ * @param state Benchmark state
+ */
+static void BM_VortexBracketCache(benchmark::State &state) {
+  std::string atcf_file = "../tests/test_files/bal122005.dat";
+  auto atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+  atcf.read();
+
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.prepareAtcfData();
+  preprocessor.solve();
+
+  auto wind_grid =
+      Gahm::Datatypes::WindGrid::fromCorners(-100, 5, -70, 35, 0.1, 0.1);
+  auto vortex = Gahm::Vortex(&atcf, wind_grid.points());
+  vortex.setThreadCount(1);
+  vortex.setUseBracketCache(state.range(0) != 0);
+
+  constexpr int time_step = 30;
+  Gahm::Datatypes::VortexSolution solution;
+  size_t nodes_processed = 0;
+  auto nodes_per_it = wind_grid.points().size();
+  auto time_start = atcf[0].date();
+  auto time = time_start;
+
+  for (auto _ : state) {
+    time.addSeconds(time_step);
+    if (time > atcf[atcf.size() - 1].date()) time = time_start;
+    vortex.solveInto(time, solution);
+    benchmark::DoNotOptimize(solution);
+    nodes_processed += nodes_per_it;
+  }
+
+  state.counters["NodeTime"] = benchmark::Counter(
+      static_cast<double>(nodes_processed), benchmark::Counter::kIsRate);
+  state.counters["NodeRate"] = benchmark::Counter(
+      static_cast<double>(nodes_processed),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * Benchmark reading an ATCF archive. The archive repeats the best track of
+ * the test file once per year, and the benchmark argument is the number of
+ * years in the archive
+ * @param state Benchmark state
+ */
+static void BM_AtcfRead(benchmark::State &state) {
+  std::ifstream source("../tests/test_files/bal122005.dat");
+  std::vector<std::string> source_lines;
+  for (std::string line; std::getline(source, line);) {
+    source_lines.push_back(line);
+  }
+
+  //...The date field starts with the four digit year
+  const auto archive_file = std::filesystem::temp_directory_path() /
+                            "gahm_benchmark_atcf_archive.dat";
+  const auto n_years = static_cast<int>(state.range(0));
+  size_t n_lines = 0;
+  {
+    std::ofstream archive(archive_file);
+    for (int year = 0; year < n_years; ++year) {
+      for (auto line : source_lines) {
+        const auto date_position = line.find("2005");
+        line.replace(date_position, 4, std::to_string(2005 - year));
+        archive << line << '\n';
+        n_lines++;
+      }
+    }
+  }
+
+  size_t lines_processed = 0;
+  for (auto _ : state) {
+    auto atcf = Gahm::Atcf::AtcfFile(archive_file.string(), true);
+    atcf.read();
+    benchmark::DoNotOptimize(atcf);
+    lines_processed += n_lines;
+  }
+
+  std::filesystem::remove(archive_file);
+
+  state.counters["LineTime"] = benchmark::Counter(
+      static_cast<double>(lines_processed), benchmark::Counter::kIsRate);
+  state.counters["LineRate"] = benchmark::Counter(
+      static_cast<double>(lines_processed),
+      benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * Benchmark preparing a track for the vortex solver. The benchmark argument
+ * selects reading and preprocessing the ATCF file (0) or reading the
+ * preprocessed track cache (1)
+ * @param state Benchmark state
+ */
+static void BM_AtcfStartup(benchmark::State &state) {
+  const std::string atcf_file = "../tests/test_files/bal122005.dat";
+  const auto cache_file =
+      (std::filesystem::temp_directory_path() / "gahm_benchmark_atcf.cache")
+          .string();
+  const bool use_cache = state.range(0) != 0;
+
+  if (use_cache) {
+    auto atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+    atcf.read();
+    auto preprocessor = Gahm::Preprocessor(&atcf);
+    preprocessor.solve();
+    Gahm::Atcf::AtcfCache::write(atcf, cache_file);
+  }
+
+  for (auto _ : state) {
+    if (use_cache) {
+      auto atcf = Gahm::Atcf::AtcfCache::read(cache_file, atcf_file);
+      benchmark::DoNotOptimize(atcf);
+    } else {
+      auto atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+      atcf.read();
+      auto preprocessor = Gahm::Preprocessor(&atcf);
+      preprocessor.solve();
+      benchmark::DoNotOptimize(atcf);
+    }
+  }
+
+  if (use_cache) std::filesystem::remove(cache_file);
+}
+
+/**
+ * Benchmark solving for the radius to max winds and GAHM B of every quadrant
+ * of the track. The benchmark arguments are the number of threads and the
+ * solve mode, which is 0 for cold starts, 1 for warm starts, 2 for batch
+ * solves and 3 for lookups in a solution cache filled before the benchmark
+ * @param state Benchmark state
+ */
+static void BM_PreprocessorSolve(benchmark::State &state) {
+  std::string atcf_file = "../tests/test_files/bal122005.dat";
+  auto atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+  atcf.read();
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.setThreadCount(static_cast<size_t>(state.range(0)));
+  preprocessor.setWarmStart(state.range(1) == 1);
+  preprocessor.setBatchSolve(state.range(1) == 2);
+
+  const bool use_cache = state.range(1) == 3;
+  const auto cache_file =
+      (std::filesystem::temp_directory_path() / "gahm_benchmark_solution.cache")
+          .string();
+  std::filesystem::remove(cache_file);
+  auto cache = Gahm::SolutionCache(cache_file);
+  if (use_cache) {
+    preprocessor.setSolutionCache(&cache);
+    preprocessor.solve();
+  }
+
+  //...Snaps which are already solved are skipped, so every snap is marked as
+  // unsolved before each solve
+  for (auto _ : state) {
+    preprocessor.invalidate();
+    preprocessor.solve();
+    benchmark::ClobberMemory();
+  }
+
+  std::filesystem::remove(cache_file);
+
+  const auto &statistics = preprocessor.solveStatistics();
+  state.counters["OuterIterations"] =
+      static_cast<double>(statistics.outer_iterations);
+  state.counters["NewtonIterations"] =
+      static_cast<double>(statistics.newton_iterations);
+}
+
+/**
+ * Benchmark bringing a solved track up to date after a new advisory appends
+ * snaps to it. The benchmark argument selects solving the whole track again
+ * (0) or only the appended snaps (1)
+ * @param state Benchmark state
+ */
+static void BM_PreprocessorAppend(benchmark::State &state) {
+  const std::string atcf_file = "../tests/test_files/bal122005.dat";
+  auto raw_atcf = Gahm::Atcf::AtcfFile(atcf_file, true);
+  raw_atcf.read();
+  const size_t n_initial = raw_atcf.size() - 2;
+  const bool incremental = state.range(0) != 0;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    Gahm::Atcf::AtcfFile atcf;
+    for (size_t i = 0; i < n_initial; ++i) atcf.addAtcfSnap(raw_atcf[i]);
+    auto preprocessor = Gahm::Preprocessor(&atcf);
+    preprocessor.solve();
+    state.ResumeTiming();
+
+    for (size_t i = n_initial; i < raw_atcf.size(); ++i) {
+      atcf.addAtcfSnap(raw_atcf[i]);
+    }
+    if (!incremental) preprocessor.invalidate();
+    preprocessor.solve();
+    benchmark::ClobberMemory();
+  }
+}
+
+#ifdef GAHM_BENCHMARK_FORTRAN
+/**
+ * Benchmark the Fortran entry point using a random point cloud the size of
+ * an ADCIRC mesh. The benchmark argument is the number of mesh nodes
+ * @param state Benchmark state
+ */
+static void BM_VortexFortran(benchmark::State &state) {
+  std::mt19937 mt(
+      std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+  // Random mesh nodes covering the storm track
+  const auto n_nodes = static_cast<long>(state.range(0));
+  std::uniform_real_distribution<double> x_dist(-100.0, -70.0);
+  std::uniform_real_distribution<double> y_dist(5.0, 35.0);
+  std::vector<double> x(n_nodes), y(n_nodes);
+  for (long i = 0; i < n_nodes; ++i) {
+    x[i] = x_dist(mt);
+    y[i] = y_dist(mt);
+  }
+
+  // Create the vortex through the Fortran interface
+  std::string atcf_file = "../tests/test_files/bal122005.dat";
+  auto id = gahm_create_ftn(atcf_file.data(), n_nodes, x.data(), y.data(),
+                            true);
+
+  std::vector<double> u(n_nodes), v(n_nodes), p(n_nodes);
+  auto time_start = Gahm::Datatypes::Date(2005, 8, 23, 18, 0, 0);
+  auto time_end = Gahm::Datatypes::Date(2005, 8, 31, 6, 0, 0);
+
+  size_t nodes_processed = 0;
+  for (auto _ : state) {
+    auto time = get_random_time(mt, time_start, time_end);
+    gahm_get_ftn(id, time.year(), time.month(), time.day(), time.hour(),
+                 time.minute(), time.second(), n_nodes, u.data(), v.data(),
+                 p.data());
+    benchmark::DoNotOptimize(u.data());
+    benchmark::DoNotOptimize(v.data());
+    benchmark::DoNotOptimize(p.data());
+    benchmark::ClobberMemory();
+    nodes_processed += n_nodes;
+  }
+
+  gahm_destroy_ftn(id);
+
   state.counters["NodeTime"] = benchmark::Counter(
       static_cast<double>(nodes_processed), benchmark::Counter::kIsRate);
   state.counters["NodeRate"] = benchmark::Counter(
       static_cast<double>(nodes_processed),
       benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
 }
+#endif
 
 /**
  * Benchmark the random time generator
@@ -110,6 +552,62 @@ static void BM_getRandomTime(benchmark::State &state) {
   }
 }
 
-BENCHMARK(BM_Vortex);
+BENCHMARK(BM_Vortex)
+    ->ArgName("threads")
+    ->RangeMultiplier(2)
+    ->Range(1, 64)
+    ->UseRealTime();
+BENCHMARK(BM_VortexMultipleDates)
+    ->ArgName("dates")
+    ->Arg(1)
+    ->Arg(24)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_VortexKernel)->ArgName("batch")->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(BM_VortexPolarGrid)
+    ->ArgName("radii")
+    ->Arg(0)
+    ->Arg(100)
+    ->Arg(200)
+    ->Arg(400)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_VortexForcingInterval)
+    ->ArgName("interval")
+    ->Arg(0)
+    ->Arg(300)
+    ->Arg(900)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_VortexBracketCache)
+    ->ArgName("cache")
+    ->Arg(0)
+    ->Arg(1)
+    ->UseRealTime();
+BENCHMARK(BM_AtcfRead)
+    ->ArgName("years")
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(50)
+    ->UseRealTime();
+BENCHMARK(BM_AtcfStartup)->ArgName("cache")->Arg(0)->Arg(1)->UseRealTime();
+BENCHMARK(BM_PreprocessorSolve)
+    ->ArgNames({"threads", "mode"})
+    ->ArgsProduct({{1, 2, 4}, {0, 1, 2, 3}})
+    ->UseRealTime();
+BENCHMARK(BM_PreprocessorAppend)
+    ->ArgName("incremental")
+    ->Arg(0)
+    ->Arg(1)
+    ->UseRealTime();
+#ifdef GAHM_BENCHMARK_FORTRAN
+BENCHMARK(BM_VortexFortran)
+    ->ArgName("nodes")
+    ->Arg(100000)
+    ->Arg(500000)
+    ->Arg(2000000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+#endif
 // BENCHMARK(BM_getRandomTime);
 BENCHMARK_MAIN();
\ No newline at end of file
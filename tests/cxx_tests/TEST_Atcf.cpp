@@ -18,6 +18,11 @@
 // Author: Zach Cobell
 // Contact: zcobell@thewaterinstitute.org
 //
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
 #include "catch2/catch_approx.hpp"
 #include "catch2/catch_test_macros.hpp"
 #include "gahm.h"
@@ -99,6 +104,32 @@ TEST_CASE("Construct AtcfSnap from string", "[AtcfSnap]") {
   REQUIRE(snap.stormName() == "KATRINA");
 }
 
+TEST_CASE("Parse AtcfSnap fields", "[AtcfSnap]") {
+  const std::string line =
+      "AL, 12, 2005082812,   , OFCL,  12, 257S,  877E, 145,  909, HU,   0, "
+      "NEQ,    0,    0,    0,    0, 1008,  300,  20, 170,   0,   L,   0,    ,  "
+      " 0,   0,    KATRINA, D,\r";
+  auto snap = Gahm::Atcf::AtcfSnap::parseAtcfSnap(line).value();
+  REQUIRE(snap.date() == Gahm::Datatypes::Date(2005, 8, 29, 0, 0, 0));
+  REQUIRE(snap.position().y() == -25.7);
+  REQUIRE(snap.position().x() == 87.7);
+  REQUIRE(snap.radiusToMaxWinds() ==
+          20.0 * Gahm::Physical::Units::convert(
+                     Gahm::Physical::Units::NauticalMile,
+                     Gahm::Physical::Units::Meter));
+  REQUIRE(snap.isotachs()[0].windSpeed() == snap.vmax());
+  REQUIRE(snap.stormName() == "KATRINA");
+
+  //...A date which is not a calendar date marks the snap as invalid
+  auto bad_date = line;
+  bad_date.replace(bad_date.find("0828"), 4, "0832");
+  REQUIRE_FALSE(Gahm::Atcf::AtcfSnap::parseAtcfSnap(bad_date)->isValid());
+
+  REQUIRE_FALSE(
+      Gahm::Atcf::AtcfSnap::parseAtcfSnap(std::string("AL, 12, 2005082812"))
+          .has_value());
+}
+
 TEST_CASE("Construct Atcf from file", "[AtcfFile]") {
   const std::string filename = "test_files/bal122005.dat";
   auto atcf = Gahm::Atcf::AtcfFile(filename);
@@ -106,4 +137,168 @@ TEST_CASE("Construct Atcf from file", "[AtcfFile]") {
 
   REQUIRE(atcf.size() == 28);
   REQUIRE(atcf[0].stormId() == 12);
-}
\ No newline at end of file
+
+  const auto date = Gahm::Datatypes::Date(2005, 8, 28, 12, 0, 0);
+  const auto it = atcf.find(date);
+  REQUIRE(it != atcf.end());
+  REQUIRE(it->date() == date);
+  REQUIRE(atcf.find(date + 1) == atcf.end());
+
+  //...A snap at an existing date adds its isotachs to that snap
+  const auto duplicate = *it;
+  const auto n_isotachs = duplicate.isotachCount();
+  atcf.addAtcfSnap(duplicate);
+  REQUIRE(atcf.size() == 28);
+  REQUIRE(atcf.find(date)->isotachCount() == 2 * n_isotachs);
+
+  //...Snaps added through data() are found as well
+  auto snap = atcf.back();
+  snap.setDate(atcf.back().date() + 21600);
+  atcf.data().push_back(snap);
+  REQUIRE(atcf.find(snap.date()) == atcf.end() - 1);
+}
+
+TEST_CASE("Time Index", "[TimeIndex]") {
+  REQUIRE_THROWS(Gahm::Atcf::TimeIndex(std::vector<int64_t>{}));
+  REQUIRE_THROWS(Gahm::Atcf::TimeIndex(std::vector<int64_t>{0, 20, 10}));
+
+  auto index = Gahm::Atcf::TimeIndex(std::vector<int64_t>{0, 10, 30, 60});
+  REQUIRE(index.size() == 4);
+  REQUIRE(index.time(2) == 30);
+
+  //...Times outside of the index are clamped to the first and last snaps
+  REQUIRE(index.find(-5) == std::make_tuple(size_t(0), 0.0));
+  REQUIRE(index.find(0) == std::make_tuple(size_t(0), 0.0));
+  REQUIRE(index.find(60) == std::make_tuple(size_t(3), 1.0));
+  REQUIRE(index.find(100) == std::make_tuple(size_t(3), 1.0));
+
+  //...A time equal to an interior snap belongs to the interval that ends
+  // there
+  REQUIRE(index.find(10) == std::make_tuple(size_t(0), 1.0));
+  REQUIRE(index.find(20) == std::make_tuple(size_t(1), 0.5));
+  REQUIRE(index.cursor() == 1);
+  REQUIRE(index.find(45) == std::make_tuple(size_t(2), 0.5));
+  REQUIRE(index.cursor() == 2);
+
+  //...Moving backward or skipping intervals falls back to a search and gives
+  // the same result as the search without the cursor
+  for (int64_t time = 65; time >= -5; time -= 3) {
+    REQUIRE(index.find(time) == index.search(time));
+  }
+  for (int64_t time = -5; time <= 65; time += 1) {
+    REQUIRE(index.find(time) == index.search(time));
+  }
+
+  //...Index built from a track
+  auto atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat");
+  atcf.read();
+  Gahm::Preprocessor prep(&atcf);
+  prep.prepareAtcfData();
+  prep.solve();
+  const auto track = Gahm::Atcf::CompiledTrack(atcf);
+  auto track_index = Gahm::Atcf::TimeIndex(track);
+  REQUIRE(track_index.size() == atcf.size());
+  for (size_t i = 0; i < atcf.size(); ++i) {
+    REQUIRE(track_index.time(i) == atcf[i].date().toSeconds());
+  }
+}
+
+TEST_CASE("Atcf Cache", "[AtcfCache]") {
+  const std::string filename = "test_files/bal122005.dat";
+  const std::string cache_filename = "gahm_test_atcf.cache";
+  std::remove(cache_filename.c_str());
+  REQUIRE_FALSE(
+      Gahm::Atcf::AtcfCache::read(cache_filename, filename).has_value());
+
+  auto atcf = Gahm::Atcf::AtcfFile(filename, true);
+  atcf.read();
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.solve();
+  Gahm::Atcf::AtcfCache::write(atcf, cache_filename);
+
+  auto cached = Gahm::Atcf::AtcfCache::read(cache_filename, filename);
+  REQUIRE(cached.has_value());
+  REQUIRE(cached->size() == atcf.size());
+  REQUIRE(cached->filename() == filename);
+  for (size_t i = 0; i < atcf.size(); ++i) {
+    const auto &a = atcf[i];
+    const auto &b = (*cached)[i];
+    REQUIRE(a.date() == b.date());
+    REQUIRE(a.basin() == b.basin());
+    REQUIRE(a.stormId() == b.stormId());
+    REQUIRE(a.stormName() == b.stormName());
+    REQUIRE(a.centralPressure() == b.centralPressure());
+    REQUIRE(a.backgroundPressure() == b.backgroundPressure());
+    REQUIRE(a.radiusToMaxWinds() == b.radiusToMaxWinds());
+    REQUIRE(a.vmax() == b.vmax());
+    REQUIRE(a.vmaxBoundaryLayer() == b.vmaxBoundaryLayer());
+    REQUIRE(a.hollandB() == b.hollandB());
+    REQUIRE(a.position().x() == b.position().x());
+    REQUIRE(a.position().y() == b.position().y());
+    REQUIRE(a.translation().translationSpeed() ==
+            b.translation().translationSpeed());
+    REQUIRE(a.translation().translationDirection() ==
+            b.translation().translationDirection());
+    REQUIRE(a.radii()[0] == b.radii()[0]);
+    REQUIRE(a.isotachCount() == b.isotachCount());
+    for (size_t j = 0; j < a.isotachCount(); ++j) {
+      REQUIRE(a.isotachs()[j].windSpeed() == b.isotachs()[j].windSpeed());
+      for (int k = 0; k < 4; ++k) {
+        const auto &qa = a.isotachs()[j].quadrant(k);
+        const auto &qb = b.isotachs()[j].quadrant(k);
+        REQUIRE(qa.quadrantIndex() == qb.quadrantIndex());
+        REQUIRE(qa.isotachRadius() == qb.isotachRadius());
+        REQUIRE(qa.radiusToMaxWindSpeed() == qb.radiusToMaxWindSpeed());
+        REQUIRE(qa.gahmHollandB() == qb.gahmHollandB());
+        REQUIRE(qa.isotachSpeedAtBoundaryLayer() ==
+                qb.isotachSpeedAtBoundaryLayer());
+        REQUIRE(qa.vmaxAtBoundaryLayer() == qb.vmaxAtBoundaryLayer());
+      }
+    }
+  }
+
+  const auto points =
+      Gahm::Datatypes::WindGrid::fromCorners(-100, 5, -70, 35, 0.5, 0.5)
+          .points();
+  const auto date = Gahm::Datatypes::Date(2005, 8, 28, 6, 0, 0);
+  const auto solution = Gahm::Vortex(&atcf, points).solve(date);
+  const auto cached_solution = Gahm::Vortex(&*cached, points).solve(date);
+  REQUIRE(solution.u() == cached_solution.u());
+  REQUIRE(solution.v() == cached_solution.v());
+  REQUIRE(solution.p() == cached_solution.p());
+
+  //...The cache is only used for the file it was built from
+  const std::string other_filename = "gahm_test_atcf_other.dat";
+  {
+    std::ifstream source(filename);
+    std::ofstream other(other_filename);
+    other << source.rdbuf() << '\n';
+  }
+  REQUIRE_FALSE(
+      Gahm::Atcf::AtcfCache::read(cache_filename, other_filename).has_value());
+  std::remove(other_filename.c_str());
+
+  //...A damaged cache is ignored
+  std::string contents;
+  {
+    std::ifstream cache(cache_filename, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(cache),
+                    std::istreambuf_iterator<char>());
+  }
+  contents[contents.size() / 2] ^= 1;
+  {
+    std::ofstream cache(cache_filename, std::ios::binary);
+    cache << contents;
+  }
+  REQUIRE_FALSE(
+      Gahm::Atcf::AtcfCache::read(cache_filename, filename).has_value());
+
+  contents.resize(contents.size() / 2);
+  {
+    std::ofstream cache(cache_filename, std::ios::binary);
+    cache << contents;
+  }
+  REQUIRE_FALSE(
+      Gahm::Atcf::AtcfCache::read(cache_filename, filename).has_value());
+  std::remove(cache_filename.c_str());
+}
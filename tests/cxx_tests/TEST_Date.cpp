@@ -0,0 +1,90 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include <type_traits>
+
+#include "catch2/catch_test_macros.hpp"
+#include "gahm.h"
+
+TEST_CASE("Date Value Type", "[date]") {
+  using Gahm::Datatypes::Date;
+  STATIC_REQUIRE(std::is_trivially_copyable_v<Date>);
+  STATIC_REQUIRE(sizeof(Date) == sizeof(int64_t));
+  STATIC_REQUIRE(Date() == Date());
+  STATIC_REQUIRE(Date().toMSeconds() == 0);
+
+  const auto d0 = Date(2005, 8, 29, 12, 30, 15, 250);
+  const auto d1 = d0 + 1;
+  REQUIRE(d0 < d1);
+  REQUIRE(d1 > d0);
+  REQUIRE(d0 <= d0);
+  REQUIRE(d0 != d1);
+  REQUIRE(d1 - 1 == d0);
+}
+
+TEST_CASE("Date Calendar Fields", "[date]") {
+  using Gahm::Datatypes::Date;
+  const auto d = Date(2005, 8, 29, 12, 30, 15, 250);
+  REQUIRE(d.year() == 2005);
+  REQUIRE(d.month() == 8);
+  REQUIRE(d.day() == 29);
+  REQUIRE(d.hour() == 12);
+  REQUIRE(d.minute() == 30);
+  REQUIRE(d.second() == 15);
+  REQUIRE(d.millisecond() == 250);
+  REQUIRE(d.get() == std::vector<long long>{2005, 8, 29, 12, 30, 15, 250});
+
+  //...Dates before the epoch round toward the earlier day
+  const auto e = Date(1969, 12, 31, 23, 59, 59, 500);
+  REQUIRE(e.toMSeconds() == -500);
+  REQUIRE(e.year() == 1969);
+  REQUIRE(e.day() == 31);
+  REQUIRE(e.second() == 59);
+  REQUIRE(e.millisecond() == 500);
+
+  auto m = Date(2005, 1, 31, 6, 0, 0);
+  m += Date::months(1);
+  REQUIRE(m == Date(2005, 3, 3, 6, 0, 0));
+}
+
+TEST_CASE("Date Milliseconds", "[date]") {
+  using Gahm::Datatypes::Date;
+  const auto d = Date(2005, 8, 29, 12, 0, 0, 750);
+  REQUIRE(d.toSeconds() == 1125316800);
+  REQUIRE(d.toMSeconds() == 1125316800750);
+
+  Date e;
+  e.fromMSeconds(d.toMSeconds());
+  REQUIRE(e == d);
+  REQUIRE(Date(e.time_point()) == d);
+
+  auto f = d;
+  f += 0.25;
+  REQUIRE(f.millisecond() == 0);
+  REQUIRE(f.second() == 1);
+  f += std::chrono::microseconds(1500);
+  REQUIRE(f.toMSeconds() == d.toMSeconds() + 251);
+
+  REQUIRE(Date::fromSeconds(1125316800) == Date(2005, 8, 29, 12, 0, 0));
+  REQUIRE(Date::fromString("2005082912", "%Y%m%d%H") ==
+          Date(2005, 8, 29, 12, 0, 0));
+  REQUIRE(d.toString() == "2005-08-29 12:00:00");
+  REQUIRE(d.toString("%Y-%m-%d %H:%M:%S") == "2005-08-29 12:00:00.750");
+}
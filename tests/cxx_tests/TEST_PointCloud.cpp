@@ -0,0 +1,172 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+//
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "gahm.h"
+
+/*
+ * Build a point cloud of uniformly distributed random points
+ */
+static auto randomPointCloud(size_t n_points) -> Gahm::Datatypes::PointCloud {
+  std::mt19937 mt(12345);
+  std::uniform_real_distribution<double> x_dist(-100.0, -60.0);
+  std::uniform_real_distribution<double> y_dist(5.0, 45.0);
+  Gahm::Datatypes::PointCloud cloud;
+  cloud.reserve(n_points);
+  for (size_t i = 0; i < n_points; ++i) {
+    cloud.addPoint(x_dist(mt), y_dist(mt));
+  }
+  return cloud;
+}
+
+TEST_CASE("PointCloud Index Bounding Box", "[PointCloud]") {
+  auto cloud = randomPointCloud(50000);
+  REQUIRE_FALSE(cloud.hasIndex());
+  REQUIRE_THROWS(cloud.queryBoundingBox(-90.0, 20.0, -80.0, 30.0));
+
+  cloud.buildIndex();
+  REQUIRE(cloud.hasIndex());
+  REQUIRE(cloud.index()->size() == cloud.size());
+
+  const std::vector<std::array<double, 4>> boxes = {
+      {-90.0, 20.0, -80.0, 30.0},
+      {-100.5, 4.0, -99.0, 6.0},
+      {-61.0, 44.0, -50.0, 60.0},
+      {-120.0, -10.0, -110.0, 0.0},
+      {-100.0, 5.0, -60.0, 45.0}};
+
+  for (const auto &box : boxes) {
+    auto result = cloud.queryBoundingBox(box[0], box[1], box[2], box[3]);
+    std::sort(result.begin(), result.end());
+
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < cloud.size(); ++i) {
+      const auto &p = cloud.points()[i];
+      if (p.x() >= box[0] && p.x() <= box[2] && p.y() >= box[1] &&
+          p.y() <= box[3]) {
+        expected.push_back(i);
+      }
+    }
+    REQUIRE(result == expected);
+  }
+}
+
+TEST_CASE("PointCloud Index Radius", "[PointCloud]") {
+  auto cloud = randomPointCloud(50000);
+  cloud.buildIndex();
+
+  const std::vector<std::array<double, 3>> queries = {
+      {-80.0, 25.0, 100.0e3},
+      {-80.0, 25.0, 750.0e3},
+      {-99.9, 5.1, 300.0e3},
+      {-70.0, 44.0, 2000.0e3}};
+
+  for (const auto &q : queries) {
+    auto result = cloud.queryRadius(q[0], q[1], q[2]);
+    std::sort(result.begin(), result.end());
+
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < cloud.size(); ++i) {
+      const auto &p = cloud.points()[i];
+      if (Gahm::Physical::Earth::distance(p.x(), p.y(), q[0], q[1]) <= q[2]) {
+        expected.push_back(i);
+      }
+    }
+    REQUIRE(!expected.empty());
+    REQUIRE(result == expected);
+  }
+}
+
+TEST_CASE("PointCloud Index Antimeridian", "[PointCloud]") {
+  //...Points on both sides of the antimeridian, stored once with longitudes
+  // from -180 to 180 and once from 0 to 360
+  std::mt19937 mt(12345);
+  std::uniform_real_distribution<double> x_dist(170.0, 190.0);
+  std::uniform_real_distribution<double> y_dist(-10.0, 10.0);
+  Gahm::Datatypes::PointCloud wrapped;
+  Gahm::Datatypes::PointCloud unwrapped;
+  for (size_t i = 0; i < 20000; ++i) {
+    const double x = x_dist(mt);
+    const double y = y_dist(mt);
+    wrapped.addPoint(x >= 180.0 ? x - 360.0 : x, y);
+    unwrapped.addPoint(x, y);
+  }
+  wrapped.buildIndex();
+  unwrapped.buildIndex();
+
+  const std::vector<std::array<double, 3>> queries = {
+      {179.5, 0.0, 300.0e3}, {-179.5, 5.0, 300.0e3}, {185.0, -5.0, 500.0e3}};
+
+  for (const auto *cloud : {&wrapped, &unwrapped}) {
+    for (const auto &q : queries) {
+      auto result = cloud->queryRadius(q[0], q[1], q[2]);
+      std::sort(result.begin(), result.end());
+
+      std::vector<size_t> expected;
+      for (size_t i = 0; i < cloud->size(); ++i) {
+        const auto &p = cloud->points()[i];
+        if (Gahm::Physical::Earth::distance(p.x(), p.y(), q[0], q[1]) <=
+            q[2]) {
+          expected.push_back(i);
+        }
+      }
+      REQUIRE(!expected.empty());
+      REQUIRE(result == expected);
+
+      //...The bounding box query holds every point within the radius
+      std::vector<size_t> candidates;
+      cloud->index()->queryRadiusBoundingBox(q[0], q[1], q[2], candidates);
+      std::sort(candidates.begin(), candidates.end());
+      REQUIRE(std::adjacent_find(candidates.begin(), candidates.end()) ==
+              candidates.end());
+      REQUIRE(std::includes(candidates.begin(), candidates.end(),
+                            expected.begin(), expected.end()));
+    }
+  }
+}
+
+TEST_CASE("PointCloud Index Invalidation", "[PointCloud]") {
+  auto cloud = randomPointCloud(1000);
+  cloud.buildIndex();
+
+  //...Copies share the index
+  auto copy = cloud;
+  REQUIRE(copy.hasIndex());
+  REQUIRE(copy.index() == cloud.index());
+
+  //...Mutating the points drops the index
+  cloud.addPoint(-80.0, 25.0);
+  REQUIRE_FALSE(cloud.hasIndex());
+  REQUIRE(copy.hasIndex());
+
+  copy.removePoint(copy.points()[0]);
+  REQUIRE_FALSE(copy.hasIndex());
+
+  //...An empty index returns no points
+  Gahm::Datatypes::PointCloud empty;
+  empty.buildIndex();
+  REQUIRE(empty.queryRadius(-80.0, 25.0, 1.0e6).empty());
+}
@@ -19,7 +19,13 @@
 // Contact: zcobell@thewaterinstitute.org
 //
 #include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <stdexcept>
+#include <string>
 
 #include "catch2/catch_approx.hpp"
 #include "catch2/catch_test_macros.hpp"
@@ -93,3 +99,515 @@ TEST_CASE("GahmAtcf", "[Preprocessor]") {
       (*atcf)[6].to_string(0, Gahm::Datatypes::Date(2005, 8, 15, 0, 0, 0), iso);
   atcf->write("gahm_test.dat");
 }
+
+TEST_CASE("Parallel Solve", "[Preprocessor]") {
+  auto serial_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  serial_atcf.read();
+  auto serial = Gahm::Preprocessor(&serial_atcf);
+  serial.solve();
+
+  auto parallel_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  parallel_atcf.read();
+  auto parallel = Gahm::Preprocessor(&parallel_atcf);
+  parallel.setThreadCount(4);
+  REQUIRE(parallel.threadCount() == 4);
+  parallel.solve();
+
+  for (size_t i = 0; i < serial_atcf.size(); ++i) {
+    const auto &a = serial_atcf[i].isotachs();
+    const auto &b = parallel_atcf[i].isotachs();
+    REQUIRE(a.size() == b.size());
+    for (size_t j = 0; j < a.size(); ++j) {
+      for (int k = 0; k < 4; ++k) {
+        REQUIRE(a[j].quadrant(k).radiusToMaxWindSpeed() ==
+                b[j].quadrant(k).radiusToMaxWindSpeed());
+        REQUIRE(a[j].quadrant(k).gahmHollandB() ==
+                b[j].quadrant(k).gahmHollandB());
+      }
+    }
+  }
+}
+
+TEST_CASE("Solver Failures", "[Preprocessor]") {
+  auto atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  atcf.read();
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.setThreadCount(4);
+
+  //...A storm with no pressure deficit has no solution
+  atcf[3].setCentralPressure(atcf[3].backgroundPressure());
+  atcf[9].setCentralPressure(atcf[9].backgroundPressure());
+
+  std::string message;
+  try {
+    preprocessor.solve();
+  } catch (const std::runtime_error &e) {
+    message = e.what();
+  }
+  REQUIRE(message.find("2005-08-24 12:00") != std::string::npos);
+  REQUIRE(message.find("2005-08-26 00:00") != std::string::npos);
+
+  //...Every other quadrant is still solved
+  REQUIRE(atcf[10].isotachs()[0].quadrant(0).radiusToMaxWindSpeed() > 0.0);
+  REQUIRE(atcf.back().isotachs()[0].quadrant(3).gahmHollandB() > 0.0);
+}
+
+TEST_CASE("Incremental Preprocessing", "[Preprocessor]") {
+  auto full_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  full_atcf.read();
+  auto full = Gahm::Preprocessor(&full_atcf);
+  full.solve();
+
+  //...Start from the track without its last snaps, then append them
+  auto raw_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  raw_atcf.read();
+  constexpr size_t n_appended = 5;
+  const size_t n_initial = raw_atcf.size() - n_appended;
+
+  Gahm::Atcf::AtcfFile atcf;
+  for (size_t i = 0; i < n_initial; ++i) atcf.addAtcfSnap(raw_atcf[i]);
+  auto preprocessor = Gahm::Preprocessor(&atcf);
+  preprocessor.solve();
+  REQUIRE(preprocessor.solveStatistics().snaps == n_initial);
+
+  //...Nothing has changed, so nothing is prepared or solved again
+  const auto revision = atcf.revision();
+  preprocessor.prepareAtcfData();
+  preprocessor.solve();
+  REQUIRE(preprocessor.solveStatistics().snaps == 0);
+  REQUIRE(preprocessor.solveStatistics().quadrants == 0);
+  REQUIRE(atcf.revision() == revision);
+  for (const auto &snap : atcf) {
+    REQUIRE(snap.radii()[0].size() == snap.isotachCount());
+  }
+
+  //...Only the appended snaps are solved, and the track matches the one
+  // preprocessed all at once
+  for (size_t i = n_initial; i < raw_atcf.size(); ++i) {
+    atcf.addAtcfSnap(raw_atcf[i]);
+  }
+  preprocessor.solve();
+  REQUIRE(preprocessor.solveStatistics().snaps == n_appended);
+  REQUIRE(atcf.revision() > revision);
+
+  REQUIRE(atcf.size() == full_atcf.size());
+  for (size_t i = 0; i < full_atcf.size(); ++i) {
+    REQUIRE(atcf[i].translation().translationSpeed() ==
+            full_atcf[i].translation().translationSpeed());
+    const auto &a = full_atcf[i].isotachs();
+    const auto &b = atcf[i].isotachs();
+    REQUIRE(b.size() == a.size());
+    for (size_t j = 0; j < a.size(); ++j) {
+      for (int k = 0; k < 4; ++k) {
+        REQUIRE(b[j].quadrant(k).isotachSpeedAtBoundaryLayer() ==
+                a[j].quadrant(k).isotachSpeedAtBoundaryLayer());
+        REQUIRE(b[j].quadrant(k).radiusToMaxWindSpeed() ==
+                a[j].quadrant(k).radiusToMaxWindSpeed());
+        REQUIRE(b[j].quadrant(k).gahmHollandB() ==
+                a[j].quadrant(k).gahmHollandB());
+      }
+    }
+  }
+
+  //...Moving a snap changes its translation and that of the snap after it.
+  // The second snap is also used for the translation of the first
+  const auto move = [](Gahm::Atcf::AtcfSnap &snap) {
+    snap.setPosition({snap.position().x() + 0.1, snap.position().y()});
+  };
+  move(atcf[10]);
+  preprocessor.solve();
+  REQUIRE(preprocessor.solveStatistics().snaps == 2);
+  move(atcf[1]);
+  preprocessor.solve();
+  REQUIRE(preprocessor.solveStatistics().snaps == 3);
+
+  //...A snap which fails to solve is attempted again
+  atcf[3].setCentralPressure(atcf[3].backgroundPressure());
+  REQUIRE_THROWS(preprocessor.solve());
+  REQUIRE(preprocessor.solveStatistics().snaps == 1);
+  REQUIRE_THROWS(preprocessor.solve());
+  REQUIRE(preprocessor.solveStatistics().snaps == 1);
+  atcf[3].setCentralPressure(raw_atcf[3].centralPressure());
+  preprocessor.solve();
+  REQUIRE(preprocessor.solveStatistics().snaps == 1);
+
+  preprocessor.invalidate();
+  preprocessor.solve();
+  REQUIRE(preprocessor.solveStatistics().snaps == atcf.size());
+}
+
+TEST_CASE("Warm Start", "[Preprocessor]") {
+  auto cold_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  cold_atcf.read();
+  auto cold = Gahm::Preprocessor(&cold_atcf);
+  cold.solve();
+
+  auto warm_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  warm_atcf.read();
+  auto warm = Gahm::Preprocessor(&warm_atcf);
+  warm.setWarmStart(true);
+  REQUIRE(warm.warmStart());
+  warm.solve();
+
+  auto parallel_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  parallel_atcf.read();
+  auto parallel = Gahm::Preprocessor(&parallel_atcf);
+  parallel.setWarmStart(true);
+  parallel.setThreadCount(4);
+  parallel.solve();
+
+  for (size_t i = 0; i < cold_atcf.size(); ++i) {
+    const auto &a = cold_atcf[i].isotachs();
+    const auto &b = warm_atcf[i].isotachs();
+    const auto &c = parallel_atcf[i].isotachs();
+    for (size_t j = 0; j < a.size(); ++j) {
+      for (int k = 0; k < 4; ++k) {
+        REQUIRE(b[j].quadrant(k).radiusToMaxWindSpeed() ==
+                Catch::Approx(a[j].quadrant(k).radiusToMaxWindSpeed())
+                    .margin(1e-3));
+        REQUIRE(b[j].quadrant(k).gahmHollandB() ==
+                Catch::Approx(a[j].quadrant(k).gahmHollandB()).margin(1e-8));
+
+        //...Seeds do not cross snaps, so the thread count does not matter
+        REQUIRE(b[j].quadrant(k).radiusToMaxWindSpeed() ==
+                c[j].quadrant(k).radiusToMaxWindSpeed());
+        REQUIRE(b[j].quadrant(k).gahmHollandB() ==
+                c[j].quadrant(k).gahmHollandB());
+      }
+    }
+  }
+
+  const auto &cold_stats = cold.solveStatistics();
+  const auto &warm_stats = warm.solveStatistics();
+  REQUIRE(cold_stats.quadrants == warm_stats.quadrants);
+  REQUIRE(cold_stats.warm_starts == 0);
+  REQUIRE(warm_stats.warm_starts == warm_stats.quadrants - cold_atcf.size());
+  REQUIRE(warm_stats.cold_restarts == 0);
+  REQUIRE(warm_stats.outer_iterations < cold_stats.outer_iterations);
+  REQUIRE(warm_stats.newton_iterations < cold_stats.newton_iterations);
+}
+
+TEST_CASE("GahmSolver Warm Start", "[Preprocessor]") {
+  constexpr double kt2ms = Gahm::Physical::Units::convert(
+      Gahm::Physical::Units::Knot, Gahm::Physical::Units::MetersPerSecond);
+  constexpr double nmi2m = Gahm::Physical::Units::convert(
+      Gahm::Physical::Units::NauticalMile, Gahm::Physical::Units::Meter);
+
+  const double vmax = 100 * kt2ms;
+  const double isorad = 65 * nmi2m;
+  const double isospd = 64 * kt2ms;
+
+  auto cold = Gahm::Solver::GahmSolver(isorad, isospd, vmax, 97900.0,
+                                       101300.0, 40.0);
+  cold.solve();
+  REQUIRE_FALSE(cold.isWarmStarted());
+  REQUIRE(cold.it() > 1);
+  REQUIRE(cold.newtonIterations() > cold.it());
+
+  //...Seeding with the solution converges on the first outer iteration
+  auto warm = Gahm::Solver::GahmSolver(isorad, isospd, vmax, 97900.0,
+                                       101300.0, 40.0);
+  warm.warmStart(cold.rmax(), cold.gahm_b());
+  REQUIRE(warm.isWarmStarted());
+  warm.solve();
+  REQUIRE(warm.it() == 1);
+  REQUIRE(warm.rmax() == Catch::Approx(cold.rmax()));
+  REQUIRE(warm.gahm_b() == Catch::Approx(cold.gahm_b()));
+
+  //...An unusable seed is ignored
+  auto ignored = Gahm::Solver::GahmSolver(isorad, isospd, vmax, 97900.0,
+                                          101300.0, 40.0);
+  ignored.warmStart(-1.0, cold.gahm_b());
+  REQUIRE_FALSE(ignored.isWarmStarted());
+}
+
+TEST_CASE("GahmFunctionAndDerivatives", "[Preprocessor]") {
+  const double vmax = 50.0;
+  const double isospd = 30.0;
+  const double isorad = 120000.0;
+  const double fc = Gahm::Physical::Earth::coriolis(25.0);
+  const double b = 1.4;
+
+  for (const double rmax : {5000.0, 30000.0, 90000.0}) {
+    const auto [f, df, d2f] =
+        Gahm::Solver::GahmEquations::GahmFunctionAndDerivatives(
+            rmax, vmax, isospd, isorad, fc, b);
+    REQUIRE(f == Catch::Approx(Gahm::Solver::GahmEquations::GahmFunction(
+                     rmax, vmax, isospd, isorad, fc, b)));
+
+    //...Central differences of the function and its derivative
+    const double h = 1.0;
+    const auto [f_lo, df_lo, d2f_lo] =
+        Gahm::Solver::GahmEquations::GahmFunctionAndDerivatives(
+            rmax - h, vmax, isospd, isorad, fc, b);
+    const auto [f_hi, df_hi, d2f_hi] =
+        Gahm::Solver::GahmEquations::GahmFunctionAndDerivatives(
+            rmax + h, vmax, isospd, isorad, fc, b);
+    REQUIRE(df == Catch::Approx((f_hi - f_lo) / (2.0 * h)).epsilon(1e-6));
+    REQUIRE(d2f == Catch::Approx((df_hi - df_lo) / (2.0 * h)).epsilon(1e-6));
+  }
+}
+
+TEST_CASE("GahmRadiusSolver", "[Preprocessor]") {
+  const double vmax = 50.0;
+  const double isospd = 30.0;
+  const double isorad = 120000.0;
+  const double fc = Gahm::Physical::Earth::coriolis(25.0);
+  const double b = 1.4;
+
+  auto newton = Gahm::Solver::GahmRadiusSolver(isorad, isospd, vmax, fc, b);
+  REQUIRE(newton.tolerance() == 1.0e-3);
+  REQUIRE_FALSE(newton.useHalley());
+  const auto rmax = newton.solve(1.0, isorad, 0.5 * isorad);
+  REQUIRE(Gahm::Solver::GahmEquations::GahmFunction(rmax, vmax, isospd,
+                                                    isorad, fc, b) ==
+          Catch::Approx(0.0).margin(1e-10));
+  REQUIRE(newton.iterations() > 0);
+  REQUIRE(newton.iterations() < 20);
+
+  auto halley = Gahm::Solver::GahmRadiusSolver(isorad, isospd, vmax, fc, b);
+  halley.setUseHalley(true);
+  REQUIRE(halley.solve(1.0, isorad, 0.5 * isorad) ==
+          Catch::Approx(rmax).margin(1e-6));
+  REQUIRE(halley.iterations() <= newton.iterations());
+
+  //...A guess far from the root needs the safeguards and still converges
+  auto far = Gahm::Solver::GahmRadiusSolver(isorad, isospd, vmax, fc, b);
+  far.setTolerance(1.0);
+  REQUIRE(far.solve(1.0, isorad, 1.0) == Catch::Approx(rmax).margin(1.0));
+  REQUIRE(far.bisections() <= far.iterations());
+
+  //...There is no root when the isotach is faster than the storm can be
+  auto none =
+      Gahm::Solver::GahmRadiusSolver(isorad, 2.0 * vmax, vmax, fc, b);
+  REQUIRE_THROWS(none.solve(1.0, isorad, 0.5 * isorad));
+}
+
+TEST_CASE("GahmBatchSolver", "[Preprocessor]") {
+  constexpr double kt2ms = Gahm::Physical::Units::convert(
+      Gahm::Physical::Units::Knot, Gahm::Physical::Units::MetersPerSecond);
+  constexpr double nmi2m = Gahm::Physical::Units::convert(
+      Gahm::Physical::Units::NauticalMile, Gahm::Physical::Units::Meter);
+
+  // clang-format off
+  std::array<double, 5> vmax = {100*kt2ms,100*kt2ms,95*kt2ms,90*kt2ms,40*kt2ms};
+  std::array<double, 5> isorad = {65*nmi2m,40*nmi2m,90*nmi2m,120*nmi2m,60*nmi2m};
+  std::array<double, 5> isospd = {64*kt2ms,64*kt2ms,50*kt2ms,34*kt2ms,80*kt2ms};
+  // clang-format on
+
+  double p0 = 97900.0;
+  double pinf = 101300.0;
+  double latitude = 40.0;
+
+  auto batch = Gahm::Solver::GahmBatchSolver(p0, pinf, latitude);
+  for (size_t i = 0; i < vmax.size(); ++i) {
+    REQUIRE(batch.addQuadrant(isorad[i], isospd[i], vmax[i]) == i);
+  }
+  REQUIRE(batch.size() == vmax.size());
+  batch.solve();
+
+  //...Each converged lane agrees with the scalar solver
+  for (size_t i = 0; i < 4; ++i) {
+    auto solver = Gahm::Solver::GahmSolver(isorad[i], isospd[i], vmax[i], p0,
+                                           pinf, latitude);
+    solver.solve();
+    REQUIRE(batch.converged(i));
+    REQUIRE(batch.error(i).empty());
+    REQUIRE(batch.rmax(i) == Catch::Approx(solver.rmax()).margin(1e-6));
+    REQUIRE(batch.gahm_b(i) == Catch::Approx(solver.gahm_b()).margin(1e-9));
+    REQUIRE(batch.it(i) == solver.it());
+  }
+
+  //...The last lane is faster than vmax and has no solution. It does not stop
+  // the other lanes
+  REQUIRE_FALSE(batch.converged(4));
+  REQUIRE(batch.error(4).find("No root") != std::string::npos);
+  REQUIRE_THROWS(batch.rmax(4));
+}
+
+TEST_CASE("Batch Solve", "[Preprocessor]") {
+  auto serial_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  serial_atcf.read();
+  auto serial = Gahm::Preprocessor(&serial_atcf);
+  serial.solve();
+
+  auto batch_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  batch_atcf.read();
+  auto batch = Gahm::Preprocessor(&batch_atcf);
+  batch.setBatchSolve(true);
+  REQUIRE(batch.batchSolve());
+  batch.setThreadCount(4);
+  batch.solve();
+
+  for (size_t i = 0; i < serial_atcf.size(); ++i) {
+    const auto &a = serial_atcf[i].isotachs();
+    const auto &b = batch_atcf[i].isotachs();
+    for (size_t j = 0; j < a.size(); ++j) {
+      for (int k = 0; k < 4; ++k) {
+        REQUIRE(b[j].quadrant(k).radiusToMaxWindSpeed() ==
+                Catch::Approx(a[j].quadrant(k).radiusToMaxWindSpeed())
+                    .margin(1e-6));
+        REQUIRE(b[j].quadrant(k).gahmHollandB() ==
+                Catch::Approx(a[j].quadrant(k).gahmHollandB()).margin(1e-9));
+      }
+    }
+  }
+  REQUIRE(batch.solveStatistics().quadrants ==
+          serial.solveStatistics().quadrants);
+  REQUIRE(batch.solveStatistics().outer_iterations ==
+          serial.solveStatistics().outer_iterations);
+
+  //...Failures are reported the same way as the scalar solves
+  batch_atcf[3].setCentralPressure(batch_atcf[3].backgroundPressure());
+  std::string message;
+  try {
+    batch.solve();
+  } catch (const std::runtime_error &e) {
+    message = e.what();
+  }
+  REQUIRE(message.find("2005-08-24 12:00") != std::string::npos);
+  REQUIRE(batch_atcf[10].isotachs()[0].quadrant(0).radiusToMaxWindSpeed() >
+          0.0);
+}
+
+TEST_CASE("Solution Cache", "[SolutionCache]") {
+  const std::string cache_filename = "gahm_test_solution.cache";
+  std::remove(cache_filename.c_str());
+
+  const auto key = [](double radius, uint64_t solver = 0) {
+    return Gahm::SolutionCache::t_key{
+        radius, 30.0, 50.0, 97900.0, 101300.0, 25.0, 1.0e-3, solver};
+  };
+
+  {
+    auto cache = Gahm::SolutionCache(cache_filename, 2);
+    REQUIRE(cache.size() == 0);
+    REQUIRE(cache.capacity() == 2);
+    cache.insert(key(1.0), {10.0, 1.1});
+    cache.insert(key(2.0), {20.0, 1.2});
+
+    //...Only identical inputs and solver configurations are a hit
+    REQUIRE_FALSE(cache.find(key(std::nextafter(1.0, 2.0))).has_value());
+    REQUIRE_FALSE(
+        cache.find(key(1.0, Gahm::SolutionCache::c_solver_batch)).has_value());
+    REQUIRE(cache.find(key(1.0))->rmax == 10.0);
+
+    //...The least recently used solution is evicted
+    cache.insert(key(3.0), {30.0, 1.3});
+    REQUIRE(cache.size() == 2);
+    REQUIRE_FALSE(cache.find(key(2.0)).has_value());
+    REQUIRE(cache.find(key(3.0))->gahm_b == 1.3);
+    REQUIRE(cache.hits() == 2);
+    REQUIRE(cache.misses() == 3);
+    cache.save();
+  }
+
+  {
+    //...Another process saves a solution while this one has the cache open
+    auto cache = Gahm::SolutionCache(cache_filename, 4);
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.find(key(1.0))->rmax == 10.0);
+
+    auto other = Gahm::SolutionCache(cache_filename, 4);
+    other.insert(key(4.0), {40.0, 1.4});
+    other.save();
+
+    cache.insert(key(5.0), {50.0, 1.5});
+    cache.save();
+  }
+
+  {
+    auto cache = Gahm::SolutionCache(cache_filename, 4);
+    REQUIRE(cache.size() == 4);
+    REQUIRE(cache.find(key(4.0))->rmax == 40.0);
+    REQUIRE(cache.find(key(5.0))->rmax == 50.0);
+
+    //...Solutions saved by the other process rank below this one's, so the
+    // oldest of them is evicted first
+    auto small = Gahm::SolutionCache(cache_filename, 3);
+    REQUIRE(small.size() == 3);
+    REQUIRE_FALSE(small.find(key(4.0)).has_value());
+  }
+
+  //...A damaged cache is ignored
+  std::string contents;
+  {
+    std::ifstream file(cache_filename, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+  }
+  contents[contents.size() / 2] ^= 1;
+  {
+    std::ofstream file(cache_filename, std::ios::binary);
+    file << contents;
+  }
+  REQUIRE(Gahm::SolutionCache(cache_filename).size() == 0);
+  std::remove(cache_filename.c_str());
+}
+
+TEST_CASE("Preprocessor Solution Cache", "[SolutionCache]") {
+  const std::string cache_filename = "gahm_test_preprocessor.cache";
+  std::remove(cache_filename.c_str());
+
+  auto solved_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  solved_atcf.read();
+  auto solved = Gahm::Preprocessor(&solved_atcf);
+  {
+    auto cache = Gahm::SolutionCache(cache_filename);
+    solved.setSolutionCache(&cache);
+    REQUIRE(solved.solutionCache() == &cache);
+    solved.solve();
+    REQUIRE(solved.solveStatistics().cache_hits == 0);
+    REQUIRE(cache.size() > 0);
+  }
+
+  auto cached_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  cached_atcf.read();
+  auto cached = Gahm::Preprocessor(&cached_atcf);
+  auto cache = Gahm::SolutionCache(cache_filename);
+  cached.setSolutionCache(&cache);
+  cached.setThreadCount(4);
+  cached.solve();
+
+  const auto &stats = cached.solveStatistics();
+  REQUIRE(stats.cache_hits == stats.quadrants);
+  REQUIRE(stats.outer_iterations == 0);
+  for (size_t i = 0; i < solved_atcf.size(); ++i) {
+    const auto &a = solved_atcf[i].isotachs();
+    const auto &b = cached_atcf[i].isotachs();
+    for (size_t j = 0; j < a.size(); ++j) {
+      for (int k = 0; k < 4; ++k) {
+        REQUIRE(a[j].quadrant(k).radiusToMaxWindSpeed() ==
+                b[j].quadrant(k).radiusToMaxWindSpeed());
+        REQUIRE(a[j].quadrant(k).gahmHollandB() ==
+                b[j].quadrant(k).gahmHollandB());
+      }
+    }
+  }
+
+  //...Warm started solves do not use the cache
+  const size_t scalar_size = cache.size();
+  cached.setWarmStart(true);
+  cached.invalidate();
+  cached.solve();
+  REQUIRE(cached.solveStatistics().cache_hits == 0);
+  REQUIRE(cached.solveStatistics().warm_starts > 0);
+  REQUIRE(cache.size() == scalar_size);
+  cached.setWarmStart(false);
+
+  //...Batch solves do not see the scalar solutions, and add their own
+  cached.setBatchSolve(true);
+  cached.invalidate();
+  cached.solve();
+  REQUIRE(cached.solveStatistics().cache_hits == 0);
+  REQUIRE(cache.size() == 2 * scalar_size);
+
+  //...A changed snap misses the cache and is solved
+  cached_atcf[5].setCentralPressure(cached_atcf[5].centralPressure() - 100.0);
+  cached.solve();
+  REQUIRE(cached.solveStatistics().snaps == 1);
+  REQUIRE(cached.solveStatistics().cache_hits == 0);
+  REQUIRE(cached.solveStatistics().quadrants ==
+          4 * cached_atcf[5].isotachCount());
+  std::remove(cache_filename.c_str());
+}
@@ -0,0 +1,103 @@
+// GNU General Public License v3.0
+//
+// This file is part of the GAHM model (https://github.com/adcirc/gahm).
+// Copyright (c) 2023 ADCIRC Development Group.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// Author: Zach Cobell
+// Contact: zcobell@thewaterinstitute.org
+//
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "catch2/catch_test_macros.hpp"
+#include "util/VectorMath.h"
+
+//...Distance between two values in units in the last place of the reference
+static auto ulpError(double value, double reference) -> double {
+  if (value == reference) return 0.0;
+  const double ulp =
+      std::nextafter(std::fabs(reference), INFINITY) - std::fabs(reference);
+  return std::fabs(value - reference) / ulp;
+}
+
+TEST_CASE("VectorMath Exp and Log", "[vectormath]") {
+  std::mt19937_64 mt(1);
+  std::uniform_real_distribution<double> exp_dist(-708.0, 709.0);
+  std::uniform_real_distribution<double> log_dist(-700.0, 700.0);
+  std::uniform_real_distribution<double> base_dist(0.01, 100.0);
+  std::uniform_real_distribution<double> exponent_dist(0.5, 2.5);
+
+  double max_exp_error = 0.0;
+  double max_log_error = 0.0;
+  double max_pow_error = 0.0;
+  for (size_t i = 0; i < 200000; ++i) {
+    const double x = exp_dist(mt);
+    max_exp_error = std::max(max_exp_error,
+                             ulpError(Gahm::VectorMath::exp(x), std::exp(x)));
+
+    const double y = std::exp(log_dist(mt));
+    max_log_error = std::max(max_log_error,
+                             ulpError(Gahm::VectorMath::log(y), std::log(y)));
+
+    const double base = base_dist(mt);
+    const double exponent = exponent_dist(mt);
+    const double bound = 2.0 * (1.0 + std::fabs(exponent * std::log(base)));
+    max_pow_error = std::max(
+        max_pow_error, ulpError(Gahm::VectorMath::pow(base, exponent),
+                                std::pow(base, exponent)) /
+                           bound);
+  }
+  REQUIRE(max_exp_error <= 2.0);
+  REQUIRE(max_log_error <= 2.0);
+  REQUIRE(max_pow_error <= 1.0);
+
+  REQUIRE(Gahm::VectorMath::exp(0.0) == 1.0);
+  REQUIRE(Gahm::VectorMath::exp(-750.0) == 0.0);
+  REQUIRE(Gahm::VectorMath::log(1.0) == 0.0);
+}
+
+TEST_CASE("VectorMath Trigonometry", "[vectormath]") {
+  std::mt19937_64 mt(2);
+  std::uniform_real_distribution<double> angle_dist(-100.0, 100.0);
+  std::uniform_real_distribution<double> coordinate_dist(-1.0, 1.0);
+
+  double max_sin_error = 0.0;
+  double max_cos_error = 0.0;
+  double max_atan2_error = 0.0;
+  for (size_t i = 0; i < 200000; ++i) {
+    const double x = angle_dist(mt);
+    double sin_x;
+    double cos_x;
+    Gahm::VectorMath::sincos(x, sin_x, cos_x);
+    max_sin_error = std::max(max_sin_error, std::fabs(sin_x - std::sin(x)));
+    max_cos_error = std::max(max_cos_error, std::fabs(cos_x - std::cos(x)));
+
+    const double a = coordinate_dist(mt);
+    const double b = coordinate_dist(mt);
+    max_atan2_error = std::max(
+        max_atan2_error,
+        ulpError(Gahm::VectorMath::atan2(a, b), std::atan2(a, b)));
+  }
+  REQUIRE(max_sin_error <= 2.0e-16);
+  REQUIRE(max_cos_error <= 2.0e-16);
+  REQUIRE(max_atan2_error <= 2.0);
+
+  REQUIRE(Gahm::VectorMath::cos(0.0) == 1.0);
+  REQUIRE(Gahm::VectorMath::atan2(0.0, 0.0) == 0.0);
+  REQUIRE(Gahm::VectorMath::atan2(1.0, 0.0) == std::atan2(1.0, 0.0));
+  REQUIRE(Gahm::VectorMath::atan2(0.0, -1.0) == std::atan2(0.0, -1.0));
+  REQUIRE(Gahm::VectorMath::atan2(-1.0, -1.0) == std::atan2(-1.0, -1.0));
+}
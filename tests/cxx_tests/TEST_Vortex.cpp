@@ -20,15 +20,47 @@
 //
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iterator>
+#include <random>
 #include <tuple>
+#include <vector>
 
 #include "catch2/catch_approx.hpp"
 #include "catch2/catch_test_macros.hpp"
 #include "fmt/core.h"
 #include "gahm.h"
 
+namespace {
+
+//...The Katrina track used by the vortex test cases. It is read and solved
+// once and then shared, since the test cases only read it
+auto katrinaTrack() -> const Gahm::Atcf::AtcfFile & {
+  static const auto atcf = [] {
+    auto track = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+    track.read();
+    Gahm::Preprocessor prep(&track);
+    prep.solve();
+    return track;
+  }();
+  return atcf;
+}
+
+//...Wind grid around the Gulf landfall of the storm
+auto gulfGrid(double resolution) -> Gahm::Datatypes::WindGrid {
+  return Gahm::Datatypes::WindGrid::fromCorners(-100.0, 22.0, -78.0, 32.0,
+                                                resolution, resolution);
+}
+
+//...Wind grid covering the life of the storm
+auto basinGrid(double resolution) -> Gahm::Datatypes::WindGrid {
+  return Gahm::Datatypes::WindGrid::fromCorners(-100.0, 15.0, -70.0, 40.0,
+                                                resolution, resolution);
+}
+
+}  // namespace
+
 TEST_CASE("Quadrant Selection", "[Vortex]") {
   constexpr double deg2rad = M_PI / 180.0;
 
@@ -45,6 +77,14 @@ TEST_CASE("Quadrant Selection", "[Vortex]") {
     std::cout << "  Actual: " << quad0 << " " << rem0 * deg2rad << std::endl;
     REQUIRE(quad0 == quad[i]);
     REQUIRE(rem0 == Catch::Approx(rem[i] * deg2rad));
+
+    //...A hint never changes the result, whether or not it is correct
+    for (int hint = 0; hint < 4; ++hint) {
+      const auto [quad1, rem1] =
+          Gahm::Vortex::getBaseQuadrant(azi[i] * deg2rad, hint);
+      REQUIRE(quad1 == quad0);
+      REQUIRE(rem1 == rem0);
+    }
   }
 }
 
@@ -140,4 +180,778 @@ TEST_CASE("Vortex", "[vortex]") {
     index++;
   }
   out.close();
-}
\ No newline at end of file
+}
+
+TEST_CASE("Vortex Parallel", "[vortex]") {
+  const auto wg = gulfGrid(0.1);
+  const auto &atcf = katrinaTrack();
+
+  auto check_time = Gahm::Datatypes::Date(2005, 8, 29, 0, 0, 0);
+
+  auto v_serial = Gahm::Vortex(&atcf, wg.points());
+  const auto serial_solution = v_serial.solve(check_time);
+
+  //...Use an odd chunk size so the last chunk is a partial one
+  auto v_parallel = Gahm::Vortex(&atcf, wg.points());
+  v_parallel.setThreadCount(4);
+  v_parallel.setChunkSize(997);
+  REQUIRE(v_parallel.threadCount() == 4);
+  REQUIRE(v_parallel.chunkSize() == 997);
+  const auto parallel_solution = v_parallel.solve(check_time);
+
+  REQUIRE(parallel_solution.size() == serial_solution.size());
+  for (size_t i = 0; i < serial_solution.size(); ++i) {
+    REQUIRE(parallel_solution[i].u() == serial_solution[i].u());
+    REQUIRE(parallel_solution[i].v() == serial_solution[i].v());
+    REQUIRE(parallel_solution[i].p() == serial_solution[i].p());
+  }
+}
+
+TEST_CASE("Vortex Solution Storage", "[vortex]") {
+  Gahm::Datatypes::VortexSolution solution;
+  solution.push_back({1.0, 2.0, 1000.0});
+  solution.emplace_back(3.0, 4.0, 1001.0);
+  solution.resize(3, Gahm::Datatypes::Uvp());
+  solution.set(2, 5.0, 6.0, 1002.0);
+
+  REQUIRE(solution.size() == 3);
+  REQUIRE(solution.uvp().size() == 3);
+  REQUIRE(solution.front().u() == 1.0);
+  REQUIRE(solution.back().p() == 1002.0);
+
+  //...The field accessors are views of the underlying storage, not copies
+  REQUIRE(solution.u().data() == solution.u().data());
+  REQUIRE(solution.u() == std::vector<double>{1.0, 3.0, 5.0});
+  REQUIRE(solution.v() == std::vector<double>{2.0, 4.0, 6.0});
+  REQUIRE(solution.p() == std::vector<double>{1000.0, 1001.0, 1002.0});
+
+  size_t index = 0;
+  for (const auto &uvp : solution.uvp()) {
+    REQUIRE(uvp.u() == solution.u()[index]);
+    REQUIRE(uvp.v() == solution.v()[index]);
+    REQUIRE(uvp.p() == solution.p()[index]);
+    index++;
+  }
+  REQUIRE(index == solution.size());
+
+  //...The non-const accessors write through to the arrays
+  solution[0] = Gahm::Datatypes::Uvp(7.0, 8.0, 1003.0);
+  solution.at(1).setU(9.0);
+  solution[2] = solution[0];
+  const Gahm::Datatypes::Uvp copy = solution[1];
+  REQUIRE(solution.u() == std::vector<double>{7.0, 9.0, 7.0});
+  REQUIRE(solution.p() == std::vector<double>{1003.0, 1001.0, 1003.0});
+  REQUIRE(copy.u() == 9.0);
+  REQUIRE_THROWS(solution.at(3));
+  REQUIRE(solution.uvp().begin() + 2 == solution.uvp().end() + (-1));
+}
+
+TEST_CASE("Vortex SolveInto", "[vortex]") {
+  const auto wg = gulfGrid(0.25);
+  const auto &atcf = katrinaTrack();
+
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  auto check_time = Gahm::Datatypes::Date(2005, 8, 29, 0, 0, 0);
+  const auto reference = vortex.solve(check_time);
+
+  //...Solving into the same object reuses its storage
+  Gahm::Datatypes::VortexSolution solution;
+  vortex.solveInto(check_time, solution);
+  const double *u_data = solution.u().data();
+  vortex.solveInto(check_time + 3600, solution);
+  vortex.solveInto(check_time, solution);
+  REQUIRE(solution.u().data() == u_data);
+  REQUIRE(solution.u() == reference.u());
+  REQUIRE(solution.v() == reference.v());
+  REQUIRE(solution.p() == reference.p());
+
+  //...Raw caller owned buffers
+  const size_t n = wg.points().size();
+  std::vector<double> u(n), v(n), p(n);
+  vortex.solveInto(check_time, u.data(), v.data(), p.data(), n);
+  REQUIRE(u == reference.u());
+  REQUIRE(v == reference.v());
+  REQUIRE(p == reference.p());
+
+  REQUIRE_THROWS(
+      vortex.solveInto(check_time, u.data(), v.data(), p.data(), n - 1));
+}
+
+TEST_CASE("Compiled Track", "[vortex]") {
+  const auto &atcf = katrinaTrack();
+
+  const auto track = Gahm::Atcf::CompiledTrack(atcf);
+  REQUIRE(track.snapCount() == atcf.size());
+
+  for (size_t snap = 0; snap < atcf.size(); ++snap) {
+    const auto &s = atcf[snap];
+    REQUIRE(track.isotachCount(snap) == s.isotachCount());
+    REQUIRE(track.isotachCount(snap) <= track.maxIsotachCount());
+    REQUIRE(track.epochSeconds(snap) == s.date().toSeconds());
+    REQUIRE(track.centralPressure(snap) == s.centralPressure());
+    REQUIRE(track.backgroundPressure(snap) == s.backgroundPressure());
+    REQUIRE(track.position(snap).x() == s.position().x());
+    REQUIRE(track.position(snap).y() == s.position().y());
+
+    for (int quadrant = 0; quadrant < 4; ++quadrant) {
+      for (size_t isotach = 0; isotach < s.isotachCount(); ++isotach) {
+        const auto &q = s.isotachs()[isotach].quadrant(quadrant);
+        const auto idx = track.index(snap, quadrant, isotach);
+        REQUIRE(track.isotachRadius(idx) == q.isotachRadius());
+        REQUIRE(track.radiusToMaxWinds(idx) == q.radiusToMaxWindSpeed());
+        REQUIRE(track.hollandB(idx) == q.gahmHollandB());
+        REQUIRE(track.vmaxAtBoundaryLayer(idx) == q.vmaxAtBoundaryLayer());
+        REQUIRE(track.isotachSpeedAtBoundaryLayer(idx) ==
+                q.isotachSpeedAtBoundaryLayer());
+      }
+
+      //...Quadrant indices wrap around like the circular array
+      REQUIRE(track.index(snap, quadrant - 4, 0) ==
+              track.index(snap, quadrant, 0));
+
+      //...Isotach brackets match the search over the snap radii
+      for (double distance = 0.0; distance < 600000.0; distance += 2500.0) {
+        const auto [iso, weight] =
+            track.isotachBracket(snap, quadrant, distance);
+        const auto [iso_ref, weight_ref] =
+            Gahm::Vortex::getBaseIsotach(distance, quadrant, s);
+        REQUIRE(iso == static_cast<size_t>(iso_ref));
+        REQUIRE(weight == weight_ref);
+      }
+
+      //...A hint never changes the bracket, including on an isotach radius
+      std::vector<double> distances;
+      for (size_t isotach = 0; isotach < s.isotachCount(); ++isotach) {
+        const double r =
+            s.isotachs()[isotach].quadrant(quadrant).isotachRadius();
+        distances.push_back(r);
+        distances.push_back(r - 1000.0);
+        distances.push_back(r + 1000.0);
+      }
+      for (const auto distance : distances) {
+        const auto bracket = track.isotachBracket(snap, quadrant, distance);
+        for (size_t hint = 0; hint <= track.maxIsotachCount(); ++hint) {
+          REQUIRE(track.isotachBracket(snap, quadrant, distance, hint) ==
+                  bracket);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Vortex Track Modified", "[vortex]") {
+  const auto wg = gulfGrid(0.25);
+  auto check_time = Gahm::Datatypes::Date(2005, 8, 29, 0, 0, 0);
+
+  auto atcf = katrinaTrack();
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  const auto original = vortex.solve(check_time);
+
+  //...Reading through the const accessors leaves the revision alone
+  const auto revision = atcf.revision();
+  const auto &const_atcf = atcf;
+  REQUIRE(const_atcf.at(0).centralPressure() ==
+          const_atcf[0].centralPressure());
+  REQUIRE(const_atcf.data().size() == atcf.size());
+  REQUIRE(atcf.revision() == revision);
+
+  //...Snaps changed through data() or at() after the vortex was built are
+  // picked up by the next solve
+  for (auto &snap : atcf.data()) {
+    snap.setCentralPressure(snap.centralPressure() - 10.0);
+  }
+  REQUIRE(atcf.revision() > revision);
+  const auto lowered = vortex.solve(check_time);
+  REQUIRE(lowered.p() != original.p());
+  auto rebuilt = Gahm::Vortex(&atcf, wg.points());
+  REQUIRE(lowered.p() == rebuilt.solve(check_time).p());
+
+  for (size_t i = 0; i < atcf.size(); ++i) {
+    atcf.at(i).setCentralPressure(atcf.at(i).centralPressure() + 10.0);
+  }
+  const auto restored = vortex.solve(check_time);
+  REQUIRE(restored.u() == original.u());
+  REQUIRE(restored.v() == original.v());
+  REQUIRE(restored.p() == original.p());
+}
+
+TEST_CASE("Vortex Geometry Cache", "[vortex]") {
+  const auto wg = basinGrid(0.1);
+  const auto &atcf = katrinaTrack();
+
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  REQUIRE_FALSE(vortex.useGeometryCache());
+
+  for (int hour = 0; hour < 144; hour += 11) {
+    auto check_time = Gahm::Datatypes::Date(2005, 8, 24, 0, 0, 0) + hour * 3600;
+
+    vortex.setUseGeometryCache(false);
+    const auto reference = vortex.solve(check_time);
+    vortex.setUseGeometryCache(true);
+    REQUIRE(vortex.useGeometryCache());
+    const auto cached = vortex.solve(check_time);
+
+    REQUIRE(cached.size() == reference.size());
+    for (size_t i = 0; i < reference.size(); ++i) {
+      REQUIRE(cached.u()[i] == Catch::Approx(reference.u()[i]).margin(1e-6));
+      REQUIRE(cached.v()[i] == Catch::Approx(reference.v()[i]).margin(1e-6));
+      REQUIRE(cached.p()[i] == Catch::Approx(reference.p()[i]).margin(1e-8));
+    }
+  }
+}
+
+TEST_CASE("Vortex Bracket Cache", "[vortex]") {
+  const auto wg = basinGrid(0.1);
+  const auto &atcf = katrinaTrack();
+
+  auto indexed_points = wg.points();
+  indexed_points.buildIndex();
+
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  auto cached_vortex = Gahm::Vortex(&atcf, wg.points());
+  auto indexed_vortex = Gahm::Vortex(&atcf, indexed_points);
+  REQUIRE_FALSE(cached_vortex.useBracketCache());
+  cached_vortex.setUseBracketCache(true);
+  cached_vortex.setThreadCount(2);
+  REQUIRE(cached_vortex.useBracketCache());
+  indexed_vortex.setUseBracketCache(true);
+  indexed_vortex.setCutoffRadius(400.0e3);
+
+  auto indexed_reference = Gahm::Vortex(&atcf, wg.points());
+  indexed_reference.setCutoffRadius(400.0e3);
+
+  //...Consecutive time steps across several track snaps, so most points keep
+  // their brackets and the rest are searched for again
+  const auto start = Gahm::Datatypes::Date(2005, 8, 28, 0, 0, 0);
+  for (int minute = 0; minute < 14 * 60; minute += 20) {
+    const auto check_time = start + minute * 60;
+    const auto reference = vortex.solve(check_time);
+    const auto cached = cached_vortex.solve(check_time);
+    REQUIRE(cached.u() == reference.u());
+    REQUIRE(cached.v() == reference.v());
+    REQUIRE(cached.p() == reference.p());
+
+    const auto indexed = indexed_vortex.solve(check_time);
+    const auto indexed_ref = indexed_reference.solve(check_time);
+    REQUIRE(indexed.u() == indexed_ref.u());
+    REQUIRE(indexed.v() == indexed_ref.v());
+    REQUIRE(indexed.p() == indexed_ref.p());
+  }
+
+  //...Stepping backward or jumping in time only costs searches
+  for (int hour = 140; hour >= 0; hour -= 17) {
+    const auto check_time =
+        Gahm::Datatypes::Date(2005, 8, 24, 0, 0, 0) + hour * 3600;
+    REQUIRE(cached_vortex.solve(check_time).u() ==
+            vortex.solve(check_time).u());
+  }
+
+  cached_vortex.setUseBracketCache(false);
+  REQUIRE_FALSE(cached_vortex.useBracketCache());
+}
+
+TEST_CASE("Vortex Cutoff Radius", "[vortex]") {
+  const auto wg = basinGrid(0.1);
+  const auto &atcf = katrinaTrack();
+
+  auto check_time = Gahm::Datatypes::Date(2005, 8, 29, 0, 0, 0);
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  REQUIRE(vortex.cutoffMode() == Gahm::Vortex::CUTOFF_MODE::NONE);
+  const auto reference = vortex.solve(check_time);
+  REQUIRE(vortex.culledPointCount() == 0);
+
+  //...Hard cutoff: points are either untouched or set to the background
+  vortex.setCutoffRadius(500.0e3);
+  REQUIRE(vortex.cutoffMode() == Gahm::Vortex::CUTOFF_MODE::ABSOLUTE);
+  const auto culled = vortex.solve(check_time);
+  const auto n_culled = vortex.culledPointCount();
+  REQUIRE(n_culled > 0);
+  REQUIRE(n_culled < reference.size());
+
+  size_t n_background = 0;
+  double background_pressure = 0.0;
+  for (size_t i = 0; i < reference.size(); ++i) {
+    const bool same = culled.u()[i] == reference.u()[i] &&
+                      culled.v()[i] == reference.v()[i] &&
+                      culled.p()[i] == reference.p()[i];
+    if (!same) {
+      REQUIRE(culled.u()[i] == 0.0);
+      REQUIRE(culled.v()[i] == 0.0);
+      if (n_background == 0) background_pressure = culled.p()[i];
+      REQUIRE(culled.p()[i] == background_pressure);
+      n_background++;
+    }
+  }
+  REQUIRE(n_background <= n_culled);
+  REQUIRE(n_background > 0);
+
+  //...The culled count does not depend on the number of threads
+  vortex.setThreadCount(3);
+  vortex.setChunkSize(1000);
+  const auto culled_parallel = vortex.solve(check_time);
+  REQUIRE(vortex.culledPointCount() == n_culled);
+  REQUIRE(culled_parallel.u() == culled.u());
+  vortex.setThreadCount(1);
+
+  //...Tapering only reduces the wind speed relative to the full solution
+  vortex.setCutoffTaper(0.5);
+  const auto tapered = vortex.solve(check_time);
+  REQUIRE(vortex.culledPointCount() == n_culled);
+  for (size_t i = 0; i < reference.size(); ++i) {
+    const double ref_speed = std::hypot(reference.u()[i], reference.v()[i]);
+    const double tap_speed = std::hypot(tapered.u()[i], tapered.v()[i]);
+    REQUIRE(tap_speed <= ref_speed + 1e-12);
+  }
+  REQUIRE_THROWS(vortex.setCutoffTaper(1.5));
+
+  //...Cutoff relative to the outermost isotach
+  vortex.setCutoffTaper(0.0);
+  vortex.setCutoffIsotachMultiple(3.0);
+  REQUIRE(vortex.cutoffMode() == Gahm::Vortex::CUTOFF_MODE::ISOTACH_MULTIPLE);
+  REQUIRE(vortex.cutoffValue() == 3.0);
+  const auto isotach_culled = vortex.solve(check_time);
+  REQUIRE(vortex.culledPointCount() > 0);
+  REQUIRE(isotach_culled.size() == reference.size());
+
+  vortex.disableCutoff();
+  REQUIRE(vortex.solve(check_time).u() == reference.u());
+  REQUIRE(vortex.culledPointCount() == 0);
+}
+
+TEST_CASE("Vortex Cutoff With Point Index", "[vortex]") {
+  const auto wg = basinGrid(0.1);
+  const auto &atcf = katrinaTrack();
+
+  auto indexed_points = wg.points();
+  indexed_points.buildIndex();
+
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  auto indexed_vortex = Gahm::Vortex(&atcf, indexed_points);
+  vortex.setCutoffRadius(400.0e3);
+  indexed_vortex.setCutoffRadius(400.0e3);
+  indexed_vortex.setThreadCount(2);
+
+  for (int hour = 0; hour < 144; hour += 13) {
+    auto check_time = Gahm::Datatypes::Date(2005, 8, 24, 0, 0, 0) + hour * 3600;
+    const auto reference = vortex.solve(check_time);
+    const auto indexed = indexed_vortex.solve(check_time);
+    REQUIRE(indexed.u() == reference.u());
+    REQUIRE(indexed.v() == reference.v());
+    REQUIRE(indexed.p() == reference.p());
+    REQUIRE(indexed_vortex.culledPointCount() == vortex.culledPointCount());
+    REQUIRE(indexed_vortex.points().hasIndex());
+  }
+}
+
+TEST_CASE("Vortex Cutoff Across The Antimeridian", "[vortex]") {
+  //...Move the track so that the storm is just west of the antimeridian at
+  // the check time. Longitudes stay within -180 to 180 like an ATCF track
+  const auto check_time = Gahm::Datatypes::Date(2005, 8, 29, 0, 0, 0);
+  auto atcf = katrinaTrack();
+  const double shift = 179.5 - atcf.find(check_time)->position().x();
+  for (auto &snap : atcf.data()) {
+    double x = snap.position().x() + shift;
+    if (x >= 180.0) x -= 360.0;
+    snap.setPosition(Gahm::Atcf::StormPosition(x, snap.position().y()));
+  }
+
+  //...Points on both sides of the antimeridian, with longitudes from -180 to
+  // 180 and from 0 to 360
+  Gahm::Datatypes::PointCloud wrapped;
+  Gahm::Datatypes::PointCloud unwrapped;
+  for (int i = 0; i < 160; ++i) {
+    for (int j = 0; j < 140; ++j) {
+      const double x = 172.05 + 0.1 * i;
+      const double y = 20.05 + 0.1 * j;
+      wrapped.addPoint(x >= 180.0 ? x - 360.0 : x, y);
+      unwrapped.addPoint(x, y);
+    }
+  }
+
+  //...The indexed solve matches the full scan, and the storm reaches the
+  // points east of the antimeridian
+  for (const auto *points : {&wrapped, &unwrapped}) {
+    auto indexed_points = *points;
+    indexed_points.buildIndex();
+
+    auto vortex = Gahm::Vortex(&atcf, *points);
+    auto indexed_vortex = Gahm::Vortex(&atcf, indexed_points);
+    vortex.setCutoffRadius(400.0e3);
+    indexed_vortex.setCutoffRadius(400.0e3);
+
+    const auto reference = vortex.solve(check_time);
+    const auto indexed = indexed_vortex.solve(check_time);
+    REQUIRE(indexed.u() == reference.u());
+    REQUIRE(indexed.v() == reference.v());
+    REQUIRE(indexed.p() == reference.p());
+    REQUIRE(indexed_vortex.culledPointCount() == vortex.culledPointCount());
+
+    size_t east_points = 0;
+    for (size_t i = 0; i < points->size(); ++i) {
+      const double x = points->points()[i].x();
+      if ((x < 0.0 || x > 180.0) && indexed.u()[i] != 0.0) east_points++;
+    }
+    REQUIRE(east_points > 0);
+  }
+}
+
+TEST_CASE("Vortex Multiple Dates", "[vortex]") {
+  const auto wg = basinGrid(0.25);
+  const auto &atcf = katrinaTrack();
+
+  std::vector<Gahm::Datatypes::Date> dates;
+  for (int hour = 0; hour < 180; hour += 9) {
+    dates.push_back(Gahm::Datatypes::Date(2005, 8, 23, 12, 0, 0) +
+                    hour * 3600);
+  }
+
+  auto batch_vortex = Gahm::Vortex(&atcf, wg.points());
+  batch_vortex.setThreadCount(3);
+  batch_vortex.setChunkSize(1500);
+  batch_vortex.setCutoffIsotachMultiple(4.0);
+  const auto solutions = batch_vortex.solve(dates);
+  const auto batch_culled = batch_vortex.culledPointCount();
+  REQUIRE(solutions.size() == dates.size());
+
+  //...The batch solve matches single solves that use the geometry cache
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  vortex.setUseGeometryCache(true);
+  vortex.setCutoffIsotachMultiple(4.0);
+  size_t culled = 0;
+  for (size_t i = 0; i < dates.size(); ++i) {
+    const auto reference = vortex.solve(dates[i]);
+    culled += vortex.culledPointCount();
+    REQUIRE(solutions[i].u() == reference.u());
+    REQUIRE(solutions[i].v() == reference.v());
+    REQUIRE(solutions[i].p() == reference.p());
+  }
+  REQUIRE(batch_culled == culled);
+
+  REQUIRE(batch_vortex.solve(std::vector<Gahm::Datatypes::Date>()).empty());
+}
+
+TEST_CASE("Fused Point Kernel", "[vortex]") {
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> rmax_dist(10.0e3, 100.0e3);
+  std::uniform_real_distribution<double> vmax_dist(15.0, 80.0);
+  std::uniform_real_distribution<double> b_dist(0.5, 2.5);
+  std::uniform_real_distribution<double> distance_dist(1.0e3, 1000.0e3);
+  std::uniform_real_distribution<double> lat_dist(5.0, 45.0);
+  std::uniform_real_distribution<double> angle_dist(0.0, 2.0 * M_PI);
+
+  for (size_t i = 0; i < 10000; ++i) {
+    const double rmax = rmax_dist(mt);
+    const double vmax = vmax_dist(mt);
+    const double b = b_dist(mt);
+    const double distance = distance_dist(mt);
+    const double f = Gahm::Physical::Earth::coriolis(lat_dist(mt));
+    const double pc = 92000.0;
+    const double pb = 101300.0;
+
+    //...Wind speed and pressure match the reference equations
+    const auto [wind_speed, pressure] =
+        Gahm::Solver::GahmEquations::GahmWindSpeedAndPressure(
+            rmax, vmax, distance, f, b, pc, pb);
+    const auto phi = Gahm::Solver::GahmEquations::phi(vmax, rmax, b, f);
+    const auto reference_speed = Gahm::Solver::GahmEquations::GahmWindSpeed(
+        rmax, vmax, distance, f, b);
+    const auto reference_pressure = Gahm::Solver::GahmEquations::GahmPressure(
+        pc, pb, distance, rmax, b, phi);
+    REQUIRE(wind_speed == Catch::Approx(reference_speed).epsilon(1e-12));
+    REQUIRE(pressure == Catch::Approx(reference_pressure).epsilon(1e-14));
+
+    //...The combined rotation matches decomposing and then rotating the
+    // wind in both hemispheres and on the equator
+    const double azimuth = angle_dist(mt);
+    const double friction = Gahm::Vortex::friction_angle(distance, rmax);
+    for (const double latitude : {-20.0, 0.0, 20.0}) {
+      const auto [u, v] =
+          Gahm::Vortex::windVector(wind_speed, azimuth, friction, latitude);
+      const auto [ud, vd] =
+          Gahm::Vortex::decomposeWindVector(wind_speed, azimuth, latitude);
+      const auto [ur, vr] =
+          Gahm::Vortex::rotate_winds(ud, vd, friction, latitude);
+      REQUIRE(u == Catch::Approx(ur).margin(1e-12));
+      REQUIRE(v == Catch::Approx(vr).margin(1e-12));
+    }
+  }
+}
+
+TEST_CASE("Vortex Batch Kernel", "[vortex]") {
+  const auto wg = basinGrid(0.1);
+  const auto &atcf = katrinaTrack();
+
+  auto indexed_points = wg.points();
+  indexed_points.buildIndex();
+
+  auto scalar_vortex = Gahm::Vortex(&atcf, wg.points());
+  auto batch_vortex = Gahm::Vortex(&atcf, wg.points());
+  auto indexed_vortex = Gahm::Vortex(&atcf, indexed_points);
+  REQUIRE_FALSE(scalar_vortex.useBatchKernel());
+  batch_vortex.setUseBatchKernel(true);
+  indexed_vortex.setUseBatchKernel(true);
+  REQUIRE(batch_vortex.useBatchKernel());
+  REQUIRE_FALSE(scalar_vortex.useBatchKernel());
+  indexed_vortex.setUseGeometryCache(true);
+  indexed_vortex.setCutoffRadius(600.0e3);
+  indexed_vortex.setCutoffTaper(0.25);
+
+  const auto check = [](const Gahm::Datatypes::VortexSolution &solution,
+                        const Gahm::Datatypes::VortexSolution &reference) {
+    REQUIRE(solution.size() == reference.size());
+    for (size_t i = 0; i < solution.size(); ++i) {
+      REQUIRE(solution.u()[i] == Catch::Approx(reference.u()[i]).margin(1e-6));
+      REQUIRE(solution.v()[i] == Catch::Approx(reference.v()[i]).margin(1e-6));
+      REQUIRE(solution.p()[i] == Catch::Approx(reference.p()[i]).margin(1e-6));
+    }
+  };
+
+  //...Covers snaps with unsorted isotach radii after landfall
+  for (int hour = 0; hour < 240; hour += 17) {
+    auto check_time = Gahm::Datatypes::Date(2005, 8, 22, 0, 0, 0) + hour * 3600;
+
+    scalar_vortex.disableCutoff();
+    check(batch_vortex.solve(check_time), scalar_vortex.solve(check_time));
+
+    scalar_vortex.setCutoffRadius(600.0e3);
+    scalar_vortex.setCutoffTaper(0.25);
+    const auto indexed = indexed_vortex.solve(check_time);
+    check(indexed, scalar_vortex.solve(check_time));
+    REQUIRE(indexed_vortex.culledPointCount() ==
+            scalar_vortex.culledPointCount());
+  }
+}
+
+TEST_CASE("Polar Grid", "[vortex]") {
+  auto grid = Gahm::PolarGrid(8, 3, 1000.0, 100000.0);
+  REQUIRE(grid.size() == 24);
+  REQUIRE(grid.radius(0) == Catch::Approx(1000.0));
+  REQUIRE(grid.radius(1) == Catch::Approx(10000.0));
+  REQUIRE(grid.radius(2) == 100000.0);
+  REQUIRE_FALSE(grid.contains(999.0));
+  REQUIRE_FALSE(grid.contains(100001.0));
+
+  //...Values that are linear in log(r) and in the spoke index are
+  // reproduced exactly by the interpolation
+  for (size_t i = 0; i < grid.radiusCount(); ++i) {
+    for (size_t j = 0; j < grid.azimuthCount(); ++j) {
+      const auto value = static_cast<double>(10 * i + j);
+      grid.set(i * grid.azimuthCount() + j, {value, -value, 1000.0 + value});
+    }
+  }
+  const double spoke = grid.azimuthSpacing();
+  const auto uvp = grid.interpolate(std::sqrt(1000.0 * 10000.0), 2.25 * spoke);
+  REQUIRE(uvp.u() == Catch::Approx(7.25));
+  REQUIRE(uvp.v() == Catch::Approx(-7.25));
+  REQUIRE(uvp.p() == Catch::Approx(1007.25));
+
+  //...Past the last spoke the values wrap around to the first one
+  const auto wrapped = grid.interpolate(10000.0, 7.5 * spoke);
+  REQUIRE(wrapped.u() == Catch::Approx(13.5));
+
+  REQUIRE_THROWS(Gahm::PolarGrid(2, 3, 1000.0, 100000.0));
+  REQUIRE_THROWS(Gahm::PolarGrid(8, 1, 1000.0, 100000.0));
+  REQUIRE_THROWS(Gahm::PolarGrid(8, 3, 1000.0, 1000.0));
+}
+
+TEST_CASE("Vortex Polar Grid", "[vortex]") {
+  const auto wg = basinGrid(0.1);
+  const auto &atcf = katrinaTrack();
+
+  auto exact_vortex = Gahm::Vortex(&atcf, wg.points());
+  auto polar_vortex = Gahm::Vortex(&atcf, wg.points());
+  auto scalar_polar_vortex = Gahm::Vortex(&atcf, wg.points());
+  polar_vortex.setPolarGrid(360, 200, 1000.0, 1000.0e3);
+  scalar_polar_vortex.setPolarGrid(360, 200, 1000.0, 1000.0e3);
+  polar_vortex.setUseBatchKernel(true);
+  REQUIRE(polar_vortex.usePolarGrid());
+  REQUIRE_FALSE(exact_vortex.usePolarGrid());
+
+  //...Accuracy check against the exact solution over the life of the storm.
+  // The largest errors occur where the exact solution itself jumps in
+  // radius, so the test bounds the root mean square error and the 99.9th
+  // percentile of the error instead of the maximum
+  std::vector<double> wind_error;
+  std::vector<double> pressure_error;
+  std::vector<Gahm::Datatypes::Date> dates;
+  for (int hour = 0; hour < 240; hour += 17) {
+    auto check_time = Gahm::Datatypes::Date(2005, 8, 22, 0, 0, 0) + hour * 3600;
+    dates.push_back(check_time);
+
+    const auto exact = exact_vortex.solve(check_time);
+    const auto polar = polar_vortex.solve(check_time);
+    const auto scalar_polar = scalar_polar_vortex.solve(check_time);
+    REQUIRE(polar_vortex.polarGrid().outerRadius() == 1000.0e3);
+
+    for (size_t i = 0; i < exact.size(); ++i) {
+      REQUIRE(std::isfinite(polar.u()[i]));
+      REQUIRE(std::isfinite(polar.v()[i]));
+      REQUIRE(std::isfinite(polar.p()[i]));
+      REQUIRE(polar.u()[i] == Catch::Approx(scalar_polar.u()[i]).margin(1e-6));
+      REQUIRE(polar.v()[i] == Catch::Approx(scalar_polar.v()[i]).margin(1e-6));
+      REQUIRE(polar.p()[i] == Catch::Approx(scalar_polar.p()[i]).margin(1e-6));
+      wind_error.push_back(std::hypot(polar.u()[i] - exact.u()[i],
+                                      polar.v()[i] - exact.v()[i]));
+      pressure_error.push_back(std::abs(polar.p()[i] - exact.p()[i]));
+    }
+  }
+
+  const auto rms = [](const std::vector<double> &error) {
+    double sum = 0.0;
+    for (const auto &e : error) sum += e * e;
+    return std::sqrt(sum / static_cast<double>(error.size()));
+  };
+  const auto percentile = [](std::vector<double> error, double fraction) {
+    const auto n = static_cast<size_t>(fraction *
+                                       static_cast<double>(error.size() - 1));
+    std::nth_element(error.begin(), error.begin() + n, error.end());
+    return error[n];
+  };
+
+  REQUIRE(rms(wind_error) < 0.01);
+  REQUIRE(rms(pressure_error) < 0.01);
+  REQUIRE(percentile(wind_error, 0.999) < 0.02);
+  REQUIRE(percentile(pressure_error, 0.999) < 0.02);
+
+  //...The multiple date solve uses a grid for each date
+  polar_vortex.setUseGeometryCache(true);
+  const auto solutions = polar_vortex.solve(dates);
+  for (size_t d = 0; d < dates.size(); ++d) {
+    const auto single = polar_vortex.solve(dates[d]);
+    REQUIRE(solutions[d].u() == single.u());
+    REQUIRE(solutions[d].v() == single.v());
+    REQUIRE(solutions[d].p() == single.p());
+  }
+
+  //...Without the grid, every point is solved exactly again
+  polar_vortex.setUseGeometryCache(false);
+  polar_vortex.setUseBatchKernel(false);
+  polar_vortex.disablePolarGrid();
+  const auto exact = exact_vortex.solve(dates[0]);
+  const auto after = polar_vortex.solve(dates[0]);
+  REQUIRE(after.u() == exact.u());
+  REQUIRE(after.p() == exact.p());
+}
+
+TEST_CASE("Vortex Forcing Interval", "[vortex]") {
+  const auto wg = basinGrid(0.1);
+  const auto &atcf = katrinaTrack();
+
+  auto exact_vortex = Gahm::Vortex(&atcf, wg.points());
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  REQUIRE(vortex.forcingInterval() == 0);
+  REQUIRE_THROWS(vortex.setForcingInterval(0));
+
+  constexpr int interval = 900;
+  vortex.setForcingInterval(interval);
+  REQUIRE(vortex.forcingInterval() == interval);
+  REQUIRE(vortex.blendFrame() == Gahm::Vortex::MESH_FRAME);
+
+  //...At a forcing time the solution is the exact solution
+  const auto time0 = Gahm::Datatypes::Date(2005, 8, 26, 0, 0, 0);
+  const auto time1 = time0 + interval;
+  const auto exact0 = exact_vortex.solve(time0);
+  const auto exact1 = exact_vortex.solve(time1);
+  const auto at_time0 = vortex.solve(time0);
+  REQUIRE(at_time0.u() == exact0.u());
+  REQUIRE(at_time0.v() == exact0.v());
+  REQUIRE(at_time0.p() == exact0.p());
+
+  //...Between forcing times the solution is the linear blend of the two
+  // bracketing solutions, and the bracket is solved only once
+  const auto solve_count = vortex.forcingSolveCount();
+  for (int step = 1; step < interval; step += 150) {
+    const auto blended = vortex.solve(time0 + step);
+    const double weight =
+        static_cast<double>(step) / static_cast<double>(interval);
+    for (size_t i = 0; i < exact0.size(); i += 7) {
+      REQUIRE(blended.u()[i] ==
+              Catch::Approx((1.0 - weight) * exact0.u()[i] +
+                            weight * exact1.u()[i])
+                  .margin(1e-8));
+      REQUIRE(blended.p()[i] ==
+              Catch::Approx((1.0 - weight) * exact0.p()[i] +
+                            weight * exact1.p()[i])
+                  .margin(1e-8));
+    }
+  }
+  REQUIRE(vortex.forcingSolveCount() == solve_count);
+
+  //...Advancing by one interval reuses the later level and solves only the
+  // new one
+  vortex.solve(time1 + 60);
+  REQUIRE(vortex.forcingSolveCount() == solve_count + 1);
+
+  //...Blending in the storm frame requires a polar grid
+  vortex.setForcingInterval(interval, Gahm::Vortex::STORM_FRAME);
+  REQUIRE(vortex.blendFrame() == Gahm::Vortex::STORM_FRAME);
+  REQUIRE_THROWS(vortex.solve(time0 + 60));
+
+  //...The multiple date solve ignores the forcing interval. Every date is
+  // fully solved, so it needs no polar grid and nothing is blended
+  auto cached_vortex = Gahm::Vortex(&atcf, wg.points());
+  cached_vortex.setUseGeometryCache(true);
+  const std::vector<Gahm::Datatypes::Date> dates{time0, time0 + 60};
+  const auto multiple = vortex.solve(dates);
+  for (size_t i = 0; i < dates.size(); ++i) {
+    const auto reference = cached_vortex.solve(dates[i]);
+    REQUIRE(multiple[i].u() == reference.u());
+    REQUIRE(multiple[i].v() == reference.v());
+    REQUIRE(multiple[i].p() == reference.p());
+  }
+  vortex.setPolarGrid(360, 200, 1000.0, 1000.0e3);
+
+  const auto check_time = time0 + interval / 3;
+  const auto exact = exact_vortex.solve(check_time);
+  const auto storm_frame = vortex.solve(check_time);
+  double sum = 0.0;
+  for (size_t i = 0; i < exact.size(); ++i) {
+    REQUIRE(std::isfinite(storm_frame.u()[i]));
+    REQUIRE(std::isfinite(storm_frame.v()[i]));
+    REQUIRE(std::isfinite(storm_frame.p()[i]));
+    sum += std::pow(storm_frame.u()[i] - exact.u()[i], 2) +
+           std::pow(storm_frame.v()[i] - exact.v()[i], 2);
+  }
+  REQUIRE(std::sqrt(sum / static_cast<double>(exact.size())) < 0.05);
+
+  //...Without the interval, every call is solved exactly again
+  vortex.disableForcingInterval();
+  vortex.disablePolarGrid();
+  REQUIRE(vortex.forcingInterval() == 0);
+  const auto after = vortex.solve(check_time);
+  REQUIRE(after.u() == exact.u());
+  REQUIRE(after.p() == exact.p());
+}
+
+TEST_CASE("Vortex Track Append", "[vortex]") {
+  const auto wg = gulfGrid(0.25);
+  auto full_vortex = Gahm::Vortex(&katrinaTrack(), wg.points());
+
+  auto raw_atcf = Gahm::Atcf::AtcfFile("test_files/bal122005.dat", true);
+  raw_atcf.read();
+  const size_t n_initial = raw_atcf.size() - 5;
+
+  Gahm::Atcf::AtcfFile atcf;
+  for (size_t i = 0; i < n_initial; ++i) atcf.addAtcfSnap(raw_atcf[i]);
+  Gahm::Preprocessor prep(&atcf);
+  prep.solve();
+
+  auto vortex = Gahm::Vortex(&atcf, wg.points());
+  vortex.solve(atcf[n_initial / 2].date());
+
+  //...The vortex picks up snaps appended after it was built
+  for (size_t i = n_initial; i < raw_atcf.size(); ++i) {
+    atcf.addAtcfSnap(raw_atcf[i]);
+  }
+  prep.solve();
+
+  for (const size_t snap : {n_initial / 2, n_initial + 2}) {
+    auto check_time = raw_atcf[snap].date();
+    check_time.addHours(1);
+    const auto expected = full_vortex.solve(check_time);
+    const auto solution = vortex.solve(check_time);
+    REQUIRE(solution.u() == expected.u());
+    REQUIRE(solution.v() == expected.v());
+    REQUIRE(solution.p() == expected.p());
+  }
+}